@@ -0,0 +1,34 @@
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+#include <cstddef>
+#include <new>
+
+// Genel operator new yerine geçer; ölçüm başına yalnızca bir kaynak dosyada dahil edilmelidir
+
+namespace alt_las {
+namespace data {
+namespace benchmark {
+
+inline std::atomic<size_t> allocations{0}; // Ayırma sayısı
+
+} // namespace benchmark
+} // namespace data
+} // namespace alt_las
+
+void* operator new(size_t size) {
+    alt_las::data::benchmark::allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* pointer = std::malloc(size > 0 ? size : 1)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    std::free(pointer);
+}
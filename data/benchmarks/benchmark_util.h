@@ -0,0 +1,60 @@
+#pragma once
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cstddef>
+
+namespace alt_las {
+namespace data {
+namespace benchmark {
+
+/**
+ * @brief İşlevin çalışma süresini ölçer
+ *
+ * @param function Ölçülecek işlev
+ * @return Geçen süre (nanosaniye)
+ */
+template <typename Function>
+double measureNs(Function&& function) {
+    auto start = std::chrono::steady_clock::now();
+    function();
+
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief İşlevi verilen sayıda iş parçacığında aynı anda çalıştırır ve süreyi ölçer
+ *
+ * @param threads İş parçacığı sayısı
+ * @param function İş parçacığı indeksini alan işlev
+ * @return İlk iş parçacığının başlatılmasından sonuncusunun bitişine kadar geçen süre (nanosaniye)
+ */
+template <typename Function>
+double measureThreadsNs(size_t threads, Function function) {
+    return measureNs([&]() {
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (size_t i = 0; i < threads; i++) {
+            workers.emplace_back(function, i);
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    });
+}
+
+/**
+ * @brief Derleyicinin sonucu kullanılmayan hesaplamayı silmesini engeller
+ *
+ * @param value Değer
+ */
+template <typename T>
+void keep(T value) {
+    [[maybe_unused]] static volatile T sink;
+    sink = value;
+}
+
+} // namespace benchmark
+} // namespace data
+} // namespace alt_las
@@ -0,0 +1,36 @@
+// Sona erme denetimlerinde kullanılan saatlerin okuma maliyetini karşılaştırır
+
+#include "data/cache_clock.h"
+#include "benchmark_util.h"
+#include <iostream>
+
+using namespace alt_las::data;
+
+namespace {
+
+constexpr size_t kIterations = 20000000;
+
+template <typename Clock>
+void report(const char* name) {
+    double ns = benchmark::measureNs([]() {
+        typename Clock::rep sum = 0;
+        for (size_t i = 0; i < kIterations; i++) {
+            sum += Clock::now().time_since_epoch().count();
+        }
+        benchmark::keep(sum);
+    });
+
+    std::cout << name << " " << ns / kIterations << " ns/op" << std::endl;
+}
+
+} // namespace
+
+int main() {
+    CoarseClock::start();
+
+    report<std::chrono::system_clock>("system_clock::now");
+    report<std::chrono::steady_clock>("steady_clock::now");
+    report<CoarseClock>("CoarseClock::now");
+
+    return 0;
+}
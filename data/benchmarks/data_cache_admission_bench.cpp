@@ -0,0 +1,81 @@
+// Tarama karışık Zipf izini yeniden oynatarak LRU ve W-TinyLFU isabet oranlarını karşılaştırır
+
+#include "data/cache_registry.h"
+#include "benchmark_util.h"
+#include <iostream>
+#include <random>
+#include <algorithm>
+#include <cmath>
+
+using namespace alt_las::data;
+
+namespace {
+
+constexpr size_t kKeyCount = 100000;     // Sıcak anahtar evreni
+constexpr size_t kCapacity = 2000;       // Önbellek kapasitesi
+constexpr size_t kAccessCount = 1000000; // İz uzunluğu
+constexpr size_t kScanInterval = 50000;  // Taramalar arası erişim sayısı
+constexpr size_t kScanLength = 5000;     // Tek seferlik tarama anahtarı sayısı
+
+/**
+ * @brief Zipf (s = 0.99) dağılımlı erişimlerle tek seferlik taramaları karıştıran iz üretir
+ */
+std::vector<std::string> buildTrace() {
+    std::vector<double> cdf(kKeyCount);
+    double total = 0;
+    for (size_t i = 0; i < kKeyCount; i++) {
+        total += 1.0 / std::pow(static_cast<double>(i + 1), 0.99);
+        cdf[i] = total;
+    }
+
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> uniform(0, total);
+    std::vector<std::string> trace;
+    trace.reserve(kAccessCount + kAccessCount / kScanInterval * kScanLength);
+    size_t scanKey = 0;
+
+    for (size_t i = 0; i < kAccessCount; i++) {
+        size_t rank = std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin();
+        trace.push_back("hot." + std::to_string(rank));
+
+        if ((i + 1) % kScanInterval == 0) {
+            for (size_t j = 0; j < kScanLength; j++) {
+                trace.push_back("scan." + std::to_string(scanKey++));
+            }
+        }
+    }
+
+    return trace;
+}
+
+} // namespace
+
+int main() {
+    std::vector<std::string> trace = buildTrace();
+
+    for (CacheAdmissionPolicy policy : {CacheAdmissionPolicy::ALWAYS, CacheAdmissionPolicy::TINY_LFU}) {
+        CacheConfig config;
+        config.capacity = kCapacity;
+        config.admissionPolicy = policy;
+        auto cache = CacheRegistry::getInstance().create("admission_bench", config);
+
+        size_t hits = 0;
+        double ns = benchmark::measureNs([&]() {
+            int value = 0;
+            for (const auto& key : trace) {
+                if (cache->tryGet(key, value)) {
+                    hits++;
+                } else {
+                    cache->set(key, 1);
+                }
+            }
+        });
+
+        std::cout << (policy == CacheAdmissionPolicy::TINY_LFU ? "TINY_LFU" : "LRU") << " hit ratio "
+                  << static_cast<double>(hits) / trace.size() << " (" << ns / trace.size() << " ns/access)" << std::endl;
+
+        CacheRegistry::getInstance().remove("admission_bench");
+    }
+
+    return 0;
+}
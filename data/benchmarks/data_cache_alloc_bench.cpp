@@ -0,0 +1,76 @@
+// Yazma/silme yükü altında işlem başına bellek ayırma sayısını ve RSS'yi ölçer
+
+#include "data/cache_registry.h"
+#include "benchmark_util.h"
+#include "allocation_counter.h"
+#include <iostream>
+#include <fstream>
+#include <random>
+#include <cstdlib>
+
+namespace {
+
+/**
+ * @brief Sürecin yerleşik bellek boyutunu döndürür (yalnızca Linux)
+ *
+ * @return RSS (kB), okunamazsa 0
+ */
+long residentKb() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmRSS:", 0) == 0) {
+            return std::atol(line.c_str() + 6);
+        }
+    }
+
+    return 0;
+}
+
+} // namespace
+
+using namespace alt_las::data;
+
+int main() {
+    constexpr size_t kKeyCount = 100000;
+    constexpr size_t kOpCount = 2000000;
+
+    CacheConfig config;
+    config.capacity = 20000;
+    config.shardCount = 16;
+    auto cache = CacheRegistry::getInstance().create("alloc_bench", config);
+
+    std::mt19937 rng(1);
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < kKeyCount; i++) {
+        keys.push_back("session:user:" + std::to_string(100000 + i) + ":profile");
+    }
+    for (size_t i = 0; i < kKeyCount / 2; i++) {
+        cache->set(keys[rng() % kKeyCount], static_cast<int>(i));
+    }
+
+    size_t allocationsBefore = benchmark::allocations.load();
+    long residentBefore = residentKb();
+
+    // Her dört işlemden biri silme, diğerleri yazma
+    double ns = benchmark::measureNs([&]() {
+        for (size_t i = 0; i < kOpCount; i++) {
+            const std::string& key = keys[rng() % kKeyCount];
+            if (i % 4 == 3) {
+                cache->remove(key);
+            } else {
+                cache->set(key, static_cast<int>(i));
+            }
+        }
+    });
+
+    auto stats = cache->getStats();
+    std::cout << "allocations/op " << static_cast<double>(benchmark::allocations.load() - allocationsBefore) / kOpCount
+              << ", " << ns / kOpCount << " ns/op" << std::endl;
+    std::cout << "rss " << residentBefore << " kB -> " << residentKb() << " kB" << std::endl;
+    std::cout << "entryAllocated " << stats["entryAllocated"] << ", entryReused " << stats["entryReused"] << std::endl;
+
+    CacheRegistry::getInstance().remove("alloc_bench");
+
+    return 0;
+}
@@ -0,0 +1,53 @@
+// Parçalı önbelleğin 1'den 64 iş parçacığına ölçeklenmesini ölçer (%90 okuma, %10 yazma)
+
+#include "data/cache_registry.h"
+#include "benchmark_util.h"
+#include <iostream>
+#include <string>
+
+using namespace alt_las::data;
+
+int main() {
+    constexpr size_t kKeyCount = 10000;
+    constexpr size_t kOpsPerThread = 200000;
+
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < kKeyCount; i++) {
+        keys.push_back("automation.worker." + std::to_string(i));
+    }
+
+    for (size_t shardCount : {1, 64}) {
+        CacheConfig config;
+        config.capacity = kKeyCount * 2;
+        config.shardCount = shardCount;
+        std::string name = "contention_bench_" + std::to_string(shardCount);
+        auto cache = CacheRegistry::getInstance().create(name, config);
+
+        for (size_t i = 0; i < kKeyCount; i++) {
+            cache->set(keys[i], static_cast<int>(i));
+        }
+
+        for (size_t threads : {1, 2, 4, 8, 16, 32, 64}) {
+            double ns = benchmark::measureThreadsNs(threads, [&](size_t thread) {
+                size_t index = thread * 7919;
+                long sum = 0;
+                for (size_t op = 0; op < kOpsPerThread; op++) {
+                    index = (index + 104729) % kKeyCount;
+                    if (op % 10 == 0) {
+                        cache->set(keys[index], static_cast<int>(op));
+                    } else {
+                        sum += cache->get<int>(keys[index], 0);
+                    }
+                }
+                benchmark::keep(sum);
+            });
+
+            double mops = threads * kOpsPerThread / ns * 1e3;
+            std::cout << "shards=" << shardCount << " threads=" << threads << " " << mops << " Mops/s" << std::endl;
+        }
+
+        CacheRegistry::getInstance().remove(name);
+    }
+
+    return 0;
+}
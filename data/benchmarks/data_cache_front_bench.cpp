@@ -0,0 +1,42 @@
+// Sıcak paylaşımlı değer okumalarının ön önbellekle ve önbelleksiz iş parçacığı ölçeklenmesini ölçer
+
+#include "data/cache_registry.h"
+#include "benchmark_util.h"
+#include <iostream>
+
+using namespace alt_las::data;
+
+int main() {
+    constexpr size_t kKeyCount = 16;
+    constexpr size_t kOpsPerThread = 500000;
+
+    for (bool front : {false, true}) {
+        CacheConfig config;
+        config.frontCache = front;
+        config.shardCount = 16;
+        auto cache = CacheRegistry::getInstance().create("front_bench", config);
+
+        std::vector<std::string> keys;
+        for (size_t i = 0; i < kKeyCount; i++) {
+            keys.push_back("config." + std::to_string(i));
+            cache->setShared<std::string>(keys.back(), std::make_shared<const std::string>("value"));
+        }
+
+        for (size_t threads : {1, 2, 4, 8, 16}) {
+            double ns = benchmark::measureThreadsNs(threads, [&](size_t) {
+                size_t total = 0;
+                for (size_t op = 0; op < kOpsPerThread; op++) {
+                    total += cache->getShared<std::string>(keys[op % kKeyCount])->size();
+                }
+                benchmark::keep(total);
+            });
+
+            double mops = threads * kOpsPerThread / ns * 1e3;
+            std::cout << (front ? "front" : "shared") << " threads=" << threads << " " << mops << " Mops/s" << std::endl;
+        }
+
+        CacheRegistry::getInstance().remove("front_bench");
+    }
+
+    return 0;
+}
@@ -0,0 +1,67 @@
+// İsabet eden aramalarda (string_view ve sabit dizgi anahtarlarla) işlem başına ayırma sayısını ölçer
+
+#include "data/cache_registry.h"
+#include "benchmark_util.h"
+#include "allocation_counter.h"
+#include <iostream>
+#include <string_view>
+
+using namespace alt_las::data;
+
+namespace {
+
+constexpr size_t kIterations = 1000000;
+
+/**
+ * @brief Aramayı tekrarlar ve işlem başına ayırma sayısını ve süreyi yazdırır
+ */
+template <typename Lookup>
+void report(const char* name, Lookup lookup) {
+    size_t before = benchmark::allocations.load();
+    long sum = 0;
+    double ns = benchmark::measureNs([&]() {
+        for (size_t i = 0; i < kIterations; i++) {
+            sum += lookup();
+        }
+    });
+    benchmark::keep(sum);
+
+    std::cout << name << " " << static_cast<double>(benchmark::allocations.load() - before) / kIterations
+              << " allocations/op, " << ns / kIterations << " ns/op" << std::endl;
+}
+
+} // namespace
+
+int main() {
+    CacheConfig config;
+    config.shardCount = 16;
+    auto cache = CacheRegistry::getInstance().create("lookup_alloc_bench", config);
+
+    // Süreli ve süresiz girdiler farklı yollardan denetlenir
+    cache->set("config.window.width", 1920, std::chrono::seconds(3600));
+    cache->set("config.window.height", 1080, std::chrono::seconds(0));
+
+    std::string owned = "config.window.width";
+    std::string_view view = owned;
+
+    report("get(string_view)", [&]() {
+        return cache->get<int>(view, 0);
+    });
+    report("get(literal)", [&]() {
+        return cache->get<int>("config.window.height", 0);
+    });
+    report("tryGet(string_view)", [&]() {
+        int value = 0;
+        return cache->tryGet(view, value) ? value : 0;
+    });
+    report("has(string_view)", [&]() {
+        return cache->has(view) ? 1 : 0;
+    });
+    report("has(literal)", [&]() {
+        return cache->has("config.window.height") ? 1 : 0;
+    });
+
+    CacheRegistry::getInstance().remove("lookup_alloc_bench");
+
+    return 0;
+}
@@ -0,0 +1,43 @@
+// Büyük değerlerde kopyalayan get ile paylaşımlı getShared yollarını karşılaştırır
+
+#include "data/cache_registry.h"
+#include "benchmark_util.h"
+#include <iostream>
+#include <cstdint>
+
+using namespace alt_las::data;
+
+int main() {
+    CacheConfig config;
+    auto cache = CacheRegistry::getInstance().create("shared_bench", config);
+
+    for (size_t size : {size_t(4) << 10, size_t(64) << 10, size_t(1) << 20}) {
+        const size_t iterations = (size_t(256) << 20) / size;
+        std::vector<uint8_t> buffer(size, 0x5A);
+        cache->set("copy", buffer);
+        cache->setShared<std::vector<uint8_t>>("shared", std::make_shared<const std::vector<uint8_t>>(buffer));
+
+        double copyNs = benchmark::measureNs([&]() {
+            size_t total = 0;
+            for (size_t i = 0; i < iterations; i++) {
+                total += cache->get<std::vector<uint8_t>>("copy", {}).size();
+            }
+            benchmark::keep(total);
+        });
+
+        double sharedNs = benchmark::measureNs([&]() {
+            size_t total = 0;
+            for (size_t i = 0; i < iterations; i++) {
+                total += cache->getShared<std::vector<uint8_t>>("shared")->size();
+            }
+            benchmark::keep(total);
+        });
+
+        std::cout << "size=" << size << " get " << copyNs / iterations << " ns/op, getShared "
+                  << sharedNs / iterations << " ns/op" << std::endl;
+    }
+
+    CacheRegistry::getInstance().remove("shared_bench");
+
+    return 0;
+}
@@ -0,0 +1,45 @@
+// Anlık görüntü kaydetme ve sıcak yeniden başlatma (yükleme) sürelerini ölçer
+
+#include "data/cache_registry.h"
+#include "benchmark_util.h"
+#include <iostream>
+#include <filesystem>
+
+using namespace alt_las::data;
+
+int main() {
+    constexpr size_t kEntryCount = 100000;
+    std::string path = (std::filesystem::temp_directory_path() / "alt_las_snapshot_bench.snap").string();
+
+    CacheConfig config;
+    config.capacity = kEntryCount * 2;
+    config.shardCount = 16;
+    auto cache = CacheRegistry::getInstance().create("snapshot_bench", config);
+    cache->registerSnapshotType<std::string>("string");
+
+    for (size_t i = 0; i < kEntryCount; i++) {
+        cache->set<std::string>("schema." + std::to_string(i), std::string(200, static_cast<char>('a' + i % 26)),
+                                std::chrono::seconds(3600), i % 2 == 0 ? "even" : "odd");
+    }
+
+    size_t saved = 0;
+    double saveNs = benchmark::measureNs([&]() {
+        saved = cache->saveSnapshot(path);
+    });
+
+    cache->clear();
+
+    size_t loaded = 0;
+    double loadNs = benchmark::measureNs([&]() {
+        loaded = cache->loadSnapshot(path);
+    });
+
+    std::cout << "entries=" << kEntryCount << " file=" << std::filesystem::file_size(path) << " bytes" << std::endl;
+    std::cout << "save " << saved << " entries in " << saveNs / 1e6 << " ms" << std::endl;
+    std::cout << "load " << loaded << " entries in " << loadNs / 1e6 << " ms" << std::endl;
+
+    std::filesystem::remove(path);
+    CacheRegistry::getInstance().remove("snapshot_bench");
+
+    return 0;
+}
@@ -0,0 +1,52 @@
+// Telemetri benzeri kayıtlarda JSON ve BINARY biçimlerinin boyutunu ve hızını karşılaştırır
+
+#include "data/data_serializer.h"
+#include "benchmark_util.h"
+#include <iostream>
+
+using namespace alt_las::data;
+
+int main() {
+    constexpr size_t kRecordCount = 2000;
+    constexpr size_t kIterations = 50;
+
+    nlohmann::json records = nlohmann::json::array();
+    for (size_t i = 0; i < kRecordCount; i++) {
+        int id = static_cast<int>(i);
+        records.push_back({{"id", id},
+                           {"timestamp", 1700000000000LL + id},
+                           {"x", id * 0.25},
+                           {"y", id * -1.5},
+                           {"label", "target_" + std::to_string(i % 17)},
+                           {"valid", i % 3 != 0},
+                           {"samples", {id, id + 1, id + 2, id + 3}}});
+    }
+
+    auto& serializer = DataSerializer::getInstance();
+    for (SerializationFormat format : {SerializationFormat::JSON, SerializationFormat::BINARY}) {
+        std::string serialized;
+        double serializeNs = benchmark::measureNs([&]() {
+            for (size_t i = 0; i < kIterations; i++) {
+                serialized = serializer.serialize(records, format);
+            }
+        });
+
+        nlohmann::json restored;
+        double deserializeNs = benchmark::measureNs([&]() {
+            for (size_t i = 0; i < kIterations; i++) {
+                restored = serializer.deserialize<nlohmann::json>(serialized, format);
+            }
+        });
+
+        if (restored != records) {
+            std::cerr << "Failed to round-trip " << serializer.getFormatString(format) << " data" << std::endl;
+            return 1;
+        }
+
+        std::cout << serializer.getFormatString(format) << " " << serialized.size() << " bytes, serialize "
+                  << serializeNs / kIterations / 1e6 << " ms, deserialize " << deserializeNs / kIterations / 1e6
+                  << " ms (" << kRecordCount << " records)" << std::endl;
+    }
+
+    return 0;
+}
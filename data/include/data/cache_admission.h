@@ -0,0 +1,83 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace alt_las {
+namespace data {
+
+/**
+ * @brief Önbellek kabul politikası
+ */
+enum class CacheAdmissionPolicy {
+    ALWAYS,     // Her yeni girdi kabul edilir
+    TINY_LFU    // W-TinyLFU: yeni girdiler küçük bir pencereden sıklık karşılaştırmasıyla ana bölgeye kabul edilir
+};
+
+/**
+ * @brief Erişim sıklığı taslağı (count-min sketch)
+ *
+ * Her anahtarın yaklaşık erişim sıklığını 4 bitlik sayaçlarla, dört satırda tutar.
+ * Ekleme sayısı örnek boyutuna ulaştığında tüm sayaçlar yarıya indirilir (yaşlandırma);
+ * böylece eskiyen sıklıklar yenilerine yer açar.
+ * Sınıf iş parçacığı güvenli değildir; çağıran, sahibi olan parçanın kilidini tutmalıdır.
+ */
+class FrequencySketch {
+public:
+    /**
+     * @brief Taslak boyutunu kapasiteye göre ayarlar
+     *
+     * Boyut değişirse sayaçlar sıfırlanır.
+     *
+     * @param capacity Beklenen en fazla girdi sayısı
+     */
+    void ensureCapacity(size_t capacity);
+
+    /**
+     * @brief Anahtarın sıklığını artırır
+     *
+     * @param hash Anahtarın karma değeri
+     */
+    void increment(uint64_t hash);
+
+    /**
+     * @brief Anahtarın tahmini sıklığını döndürür
+     *
+     * @param hash Anahtarın karma değeri
+     * @return Tahmini sıklık (0-15)
+     */
+    uint32_t estimate(uint64_t hash) const;
+
+    /**
+     * @brief Tüm sayaçları sıfırlar
+     */
+    void clear();
+
+    static constexpr size_t kDepth = 4;        // Satır sayısı
+    static constexpr uint64_t kMaxCount = 15;  // Sayaç üst sınırı
+
+private:
+    /**
+     * @brief Satırdaki sayacın konumunu hesaplar
+     *
+     * @param hash Anahtarın karma değeri
+     * @param row Satır
+     * @param word Kelime indeksi
+     * @param shift Kelime içindeki bit kayması
+     */
+    void locate(uint64_t hash, size_t row, size_t& word, unsigned& shift) const;
+
+    /**
+     * @brief Tüm sayaçları yarıya indirir
+     */
+    void age();
+
+    std::vector<uint64_t> table_; // Her kelimede 16 adet 4 bitlik sayaç
+    size_t capacity_ = 0;         // Ayarlı kapasite
+    size_t additions_ = 0;        // Son yaşlandırmadan beri ekleme sayısı
+    size_t sampleSize_ = 0;       // Yaşlandırma eşiği
+};
+
+} // namespace data
+} // namespace alt_las
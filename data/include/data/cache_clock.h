@@ -0,0 +1,77 @@
+#pragma once
+
+#include <chrono>
+#include <atomic>
+#include <cstdint>
+
+namespace alt_las {
+namespace data {
+
+/**
+ * @brief Önbellek yaşam süreleri için kaba tekdüze saat
+ *
+ * Arka plan iş parçacığı steady_clock zamanını her kResolution'da bir atomik
+ * değişkene yazar; now() yalnızca bu değişkeni okur ve sistem çağrısı yapmaz.
+ * Saat tekdüzedir; duvar saati ayarlansa da (NTP, elle değişiklik) geri gitmez
+ * veya sıçramaz. Okunan zaman gerçek zamanın en fazla kResolution kadar
+ * gerisindedir; girdiler bu kadar geç sona erebilir.
+ * İş parçacığı start() ile başlatılır ve süreç kapanırken durdurulur; başlatılmadan
+ * önce now() steady_clock'u doğrudan okur.
+ */
+class CoarseClock {
+public:
+    using duration = std::chrono::steady_clock::duration;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<CoarseClock>;
+
+    static constexpr bool is_steady = true;
+    static constexpr std::chrono::milliseconds kResolution{4}; // Güncelleme aralığı
+
+    /**
+     * @brief Son güncellenen zamanı döndürür
+     *
+     * @return Şimdiki zaman (en fazla kResolution gecikmeli)
+     */
+    static time_point now() noexcept {
+        // İş parçacığı burada başlatılmaz; başlatma hata fırlatabilir
+        rep ticks = ticks_.load(std::memory_order_relaxed);
+        if (ticks == 0) {
+            ticks = std::chrono::steady_clock::now().time_since_epoch().count();
+        }
+
+        return time_point(duration(ticks));
+    }
+
+    /**
+     * @brief Güncelleme iş parçacığını başlatır
+     *
+     * Saati kullanan singleton'lar, yapıcılarında bu işlevi çağırarak iş
+     * parçacığının kendilerinden sonra durdurulmasını sağlar.
+     *
+     * @return Şimdiki zaman (steady_clock tikleri)
+     */
+    static rep start();
+
+    /**
+     * @brief Saat zamanını duvar saati zamanına dönüştürür
+     *
+     * @param time Saat zamanı
+     * @return Duvar saati zamanı
+     */
+    static std::chrono::system_clock::time_point toSystem(time_point time);
+
+    /**
+     * @brief Duvar saati zamanını saat zamanına dönüştürür
+     *
+     * @param time Duvar saati zamanı
+     * @return Saat zamanı
+     */
+    static time_point fromSystem(std::chrono::system_clock::time_point time);
+
+private:
+    static inline std::atomic<rep> ticks_{0}; // Son güncellenen steady_clock tikleri, başlamadıysa 0
+};
+
+} // namespace data
+} // namespace alt_las
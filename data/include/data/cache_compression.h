@@ -0,0 +1,70 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <any>
+#include <memory>
+#include <typeindex>
+#include <cstddef>
+#include "data/cache_snapshot.h"
+
+namespace alt_las {
+namespace data {
+
+/**
+ * @brief Sıkıştırılmış önbellek değeri
+ *
+ * Değer, türünün anlık görüntü kodlayıcısıyla kodlanır ve compressCacheBytes()
+ * ile sıkıştırılır. Önbellek, girdinin boyutu olarak sıkıştırılmış boyutu sayar;
+ * özgün boyut ayrıca tutulur.
+ */
+struct CompressedCacheValue {
+    std::string bytes;                                  // Sıkıştırılmış kodlanmış değer
+    size_t encodedSize = 0;                             // Kodlanmış değerin boyutu
+    size_t rawSize = 0;                                 // Sıkıştırılmamış girdinin tahmini boyutu (değer + anahtar)
+    std::type_index type = typeid(void);                // Değer türü
+    std::shared_ptr<const CacheSnapshotCodec> codec;    // Değer kodlayıcısı
+
+    /**
+     * @brief Kodlanmış değeri açar
+     *
+     * @return Kodlanmış değer
+     * @throws std::runtime_error Sıkıştırılmış veri bozuksa
+     */
+    std::string decompress() const;
+
+    /**
+     * @brief Değeri açar ve çözer
+     *
+     * @return Değer
+     * @throws std::exception Veri bozuksa veya çözülemezse
+     */
+    std::any value() const;
+};
+
+/**
+ * @brief Baytları hızlı LZ77 biçimiyle sıkıştırır
+ *
+ * Biçim LZ4 blok biçimine benzer: her dizi, üst 4 biti değişmez uzunluğu ve alt
+ * 4 biti eşleşme uzunluğunu (4 eksiğiyle) tutan bir belirteç, uzun uzunluklar için
+ * 255'lik ek baytlar, değişmez baytlar, 16 bit küçük sonlu uzaklık ve eşleşme
+ * uzunluğu ek baytlarından oluşur. Son dizi yalnızca değişmez baytlar içerir.
+ * Eşleşmeler 64 KiB pencerede, 4 baytlık dizilerin karma tablosuyla aranır.
+ *
+ * @param input Girdi
+ * @return Sıkıştırılmış veri
+ */
+std::string compressCacheBytes(std::string_view input);
+
+/**
+ * @brief compressCacheBytes() ile sıkıştırılmış baytları açar
+ *
+ * @param input Sıkıştırılmış veri
+ * @param outputSize Açılmış verinin boyutu
+ * @param output Açılmış veri
+ * @return Başarılıysa true, veri bozuksa false
+ */
+bool decompressCacheBytes(std::string_view input, size_t outputSize, std::string& output);
+
+} // namespace data
+} // namespace alt_las
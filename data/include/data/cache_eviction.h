@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cstddef>
+
+namespace alt_las {
+namespace data {
+
+/**
+ * @brief Önbellek tahliye politikası
+ */
+enum class EvictionPolicy {
+    LRU,        // En uzun süredir kullanılmayan girdi
+    CLOCK,      // Saat algoritması (ikinci şans)
+    FIFO        // İlk eklenen girdi
+};
+
+/**
+ * @brief Tahliye listesi bağlantısı
+ *
+ * Önbellek girdileri bu yapıdan türetilir; tahliye listesi girdileri
+ * ek bellek ayırmadan birbirine bağlar.
+ */
+struct EvictionHook {
+    EvictionHook* prev = nullptr;   // Önceki girdi
+    EvictionHook* next = nullptr;   // Sonraki girdi
+    bool referenced = false;        // CLOCK referans biti
+
+    EvictionHook() = default;
+
+    /**
+     * @brief Kopyalama yapıcısı (bağlantılar kopyalanmaz)
+     */
+    EvictionHook(const EvictionHook&) {}
+
+    /**
+     * @brief Atama operatörü (bağlantılar kopyalanmaz)
+     */
+    EvictionHook& operator=(const EvictionHook&) { return *this; }
+};
+
+/**
+ * @brief Tahliye listesi
+ *
+ * Girdileri kullanım sırasına göre tutan çift bağlı, müdahaleci (intrusive) listedir.
+ * Ekleme, silme, kullanım bildirimi ve kurban seçimi O(1) (CLOCK için amortize O(1)) maliyetlidir.
+ * Sınıf iş parçacığı güvenli değildir; çağıran, sahibi olan parçanın kilidini tutmalıdır.
+ */
+class EvictionList {
+public:
+    /**
+     * @brief Yapıcı
+     *
+     * @param policy Tahliye politikası
+     */
+    explicit EvictionList(EvictionPolicy policy = EvictionPolicy::LRU);
+
+    /**
+     * @brief Kopyalama yapıcısı (engellendi)
+     */
+    EvictionList(const EvictionList&) = delete;
+
+    /**
+     * @brief Atama operatörü (engellendi)
+     */
+    EvictionList& operator=(const EvictionList&) = delete;
+
+    /**
+     * @brief Tahliye politikasını döndürür
+     *
+     * @return Tahliye politikası
+     */
+    EvictionPolicy getPolicy() const;
+
+    /**
+     * @brief Tahliye politikasını ayarlar
+     *
+     * @param policy Tahliye politikası
+     */
+    void setPolicy(EvictionPolicy policy);
+
+    /**
+     * @brief Girdiyi listeye ekler
+     *
+     * @param hook Girdi
+     */
+    void insert(EvictionHook* hook);
+
+    /**
+     * @brief Girdiyi listeden çıkarır
+     *
+     * @param hook Girdi
+     */
+    void erase(EvictionHook* hook);
+
+    /**
+     * @brief Girdinin kullanıldığını bildirir
+     *
+     * @param hook Girdi
+     */
+    void touch(EvictionHook* hook);
+
+    /**
+     * @brief Tahliye edilecek girdiyi seçer
+     *
+     * Girdi listeden çıkarılmaz.
+     *
+     * @return Kurban girdi, liste boşsa nullptr
+     */
+    EvictionHook* victim();
+
+    /**
+     * @brief En eski girdiyi döndürür
+     *
+     * @return En eski girdi, liste boşsa nullptr
+     */
+    EvictionHook* front() const;
+
+    /**
+     * @brief Sonraki girdiyi döndürür
+     *
+     * @param hook Girdi
+     * @return Sonraki girdi, liste sonundaysa nullptr
+     */
+    EvictionHook* next(const EvictionHook* hook) const;
+
+    /**
+     * @brief Listeyi boşaltır
+     */
+    void clear();
+
+    /**
+     * @brief Listedeki girdi sayısını döndürür
+     *
+     * @return Girdi sayısı
+     */
+    size_t size() const;
+
+private:
+    /**
+     * @brief Girdiyi verilen konumun önüne bağlar
+     *
+     * @param hook Girdi
+     * @param position Konum
+     */
+    void linkBefore(EvictionHook* hook, EvictionHook* position);
+
+    /**
+     * @brief Girdinin bağlantılarını çözer
+     *
+     * @param hook Girdi
+     */
+    void unlink(EvictionHook* hook);
+
+    /**
+     * @brief Saat ibresini bir sonraki girdiye ilerletir
+     */
+    void advanceHand();
+
+    EvictionHook head_; // Gözcü düğüm (en eski girdi head_.next)
+    EvictionHook* hand_; // CLOCK ibresi
+    EvictionPolicy policy_; // Tahliye politikası
+    size_t size_; // Girdi sayısı
+};
+
+} // namespace data
+} // namespace alt_las
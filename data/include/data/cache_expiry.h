@@ -0,0 +1,127 @@
+#pragma once
+
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#include <cstddef>
+#include "data/cache_clock.h"
+
+namespace alt_las {
+namespace data {
+
+/**
+ * @brief Sona erme kuyruğu
+ *
+ * Anahtarları sona erme zamanına göre tutan en küçük yığındır (min-heap).
+ * Silinen veya yeniden yazılan girdiler kuyruktan hemen çıkarılmaz; bu eski
+ * kayıtlar zamanı geldiğinde atlanır ya da compact() ile temizlenir.
+ * Sınıf iş parçacığı güvenli değildir; çağıran, sahibi olan parçanın kilidini tutmalıdır.
+ */
+template <typename Key, typename TimePoint = CoarseClock::time_point>
+class ExpiryQueue {
+public:
+    /**
+     * @brief Anahtarı kuyruğa ekler
+     *
+     * @param key Anahtar
+     * @param expiresAt Sona erme zamanı
+     */
+    void push(const Key& key, TimePoint expiresAt) {
+        heap_.push_back(Item{expiresAt, key});
+        std::push_heap(heap_.begin(), heap_.end(), ItemCompare());
+    }
+
+    /**
+     * @brief Zamanı gelmiş kayıtları çıkarır
+     *
+     * Her kayıt için onDue(key, expiresAt) çağrılır. Geçerliliği denetlemek çağıranın işidir.
+     *
+     * @param now Şimdiki zaman
+     * @param limit En fazla çıkarılacak kayıt sayısı
+     * @param onDue Kayıt işleyicisi
+     * @return Çıkarılan kayıt sayısı
+     */
+    template <typename Callback>
+    size_t popDue(TimePoint now, size_t limit, Callback&& onDue) {
+        size_t count = 0;
+
+        while (count < limit && !heap_.empty() && heap_.front().expiresAt <= now) {
+            std::pop_heap(heap_.begin(), heap_.end(), ItemCompare());
+            Item item = std::move(heap_.back());
+            heap_.pop_back();
+
+            onDue(item.key, item.expiresAt);
+            count++;
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Zamanı gelmiş kayıt olup olmadığını kontrol eder
+     *
+     * @param now Şimdiki zaman
+     * @return Kayıt varsa true, yoksa false
+     */
+    bool hasDue(TimePoint now) const {
+        return !heap_.empty() && heap_.front().expiresAt <= now;
+    }
+
+    /**
+     * @brief Geçersiz kayıtları kuyruktan temizler
+     *
+     * @param isLive Kaydın hâlâ geçerli olup olmadığını bildiren fonksiyon
+     * @return Temizlenen kayıt sayısı
+     */
+    template <typename Predicate>
+    size_t compact(Predicate&& isLive) {
+        size_t before = heap_.size();
+
+        heap_.erase(std::remove_if(heap_.begin(), heap_.end(), [&isLive](const Item& item) {
+            return !isLive(item.key, item.expiresAt);
+        }), heap_.end());
+        std::make_heap(heap_.begin(), heap_.end(), ItemCompare());
+
+        return before - heap_.size();
+    }
+
+    /**
+     * @brief Kuyruğu boşaltır
+     */
+    void clear() {
+        heap_.clear();
+    }
+
+    /**
+     * @brief Kuyruktaki kayıt sayısını döndürür
+     *
+     * @return Kayıt sayısı
+     */
+    size_t size() const {
+        return heap_.size();
+    }
+
+private:
+    /**
+     * @brief Kuyruk kaydı
+     */
+    struct Item {
+        TimePoint expiresAt;    // Sona erme zamanı
+        Key key;                // Anahtar
+    };
+
+    /**
+     * @brief En erken zamanı yığının tepesinde tutan karşılaştırıcı
+     */
+    struct ItemCompare {
+        bool operator()(const Item& a, const Item& b) const {
+            return a.expiresAt > b.expiresAt;
+        }
+    };
+
+    std::vector<Item> heap_; // Kayıt yığını
+};
+
+} // namespace data
+} // namespace alt_las
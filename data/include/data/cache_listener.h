@@ -0,0 +1,171 @@
+#pragma once
+
+#include <string>
+#include <any>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <condition_variable>
+#include <functional>
+#include <cstddef>
+
+namespace alt_las {
+namespace data {
+
+/**
+ * @brief Önbellek girdisinin çıkarılma nedeni
+ */
+enum class CacheRemovalReason {
+    EVICTED,   // Kapasite veya bellek bütçesi nedeniyle tahliye edildi
+    EXPIRED,   // Süresi doldu
+    REMOVED,   // Açıkça silindi (remove, removeMany, clearByTags)
+    REPLACED,  // Aynı anahtara yeni değer yazıldı
+    CLEARED    // Önbellek temizlendi
+};
+
+/**
+ * @brief Çıkarılma nedeninin adını döndürür
+ *
+ * @param reason Neden
+ * @return Neden adı (ör. "evicted")
+ */
+const char* getCacheRemovalReasonName(CacheRemovalReason reason);
+
+/**
+ * @brief Önbellek girdisinin çıkarılma olayı
+ */
+struct CacheRemovalEvent {
+    std::string key;            // Anahtar
+    std::any value;             // Çıkarılan değer
+    CacheRemovalReason reason;  // Neden
+};
+
+/**
+ * @brief Çıkarılma dinleyicisi
+ */
+using CacheRemovalListener = std::function<void(const CacheRemovalEvent&)>;
+
+/**
+ * @brief Çıkarılma olaylarını dinleyicilere ileten sınırlı kuyruk
+ *
+ * Olaylar önbellek kilidi altında kuyruğa eklenir ve kendi iş parçacığında,
+ * hiçbir önbellek kilidi tutulmadan dinleyicilere iletilir. Kuyruk doluysa
+ * olay düşürülür; yavaş dinleyiciler yazmaları hiçbir zaman bekletmez.
+ * Sıkıştırılmış değerler (CompressedCacheValue) iletim iş parçacığında açılır.
+ * İş parçacığı ilk olayla başlatılır, yıkıcı bekleyen olayları iletip durdurur.
+ * Sınıf iş parçacığı güvenlidir.
+ */
+class CacheEventDispatcher {
+public:
+    /**
+     * @brief Yapıcı
+     *
+     * @param queueCapacity Kuyruk kapasitesi
+     */
+    explicit CacheEventDispatcher(size_t queueCapacity);
+
+    /**
+     * @brief Yıkıcı
+     */
+    ~CacheEventDispatcher();
+
+    /**
+     * @brief Kopyalama yapıcısı (engellendi)
+     */
+    CacheEventDispatcher(const CacheEventDispatcher&) = delete;
+
+    /**
+     * @brief Atama operatörü (engellendi)
+     */
+    CacheEventDispatcher& operator=(const CacheEventDispatcher&) = delete;
+
+    /**
+     * @brief Dinleyici ekler
+     *
+     * @param listener Dinleyici
+     * @return Dinleyici kimliği
+     */
+    size_t addListener(CacheRemovalListener listener);
+
+    /**
+     * @brief Dinleyiciyi çıkarır
+     *
+     * Çıkarılan dinleyici, o sırada iletilmekte olan olayı almaya devam edebilir.
+     *
+     * @param id Dinleyici kimliği
+     * @return Dinleyici bulunduysa true, değilse false
+     */
+    bool removeListener(size_t id);
+
+    /**
+     * @brief Dinleyici olup olmadığını kontrol eder
+     *
+     * @return Dinleyici varsa true, yoksa false
+     */
+    bool hasListeners() const {
+        return hasListeners_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Olayı kuyruğa ekler
+     *
+     * @param event Olay
+     * @return Olay eklendiyse true, kuyruk dolu olduğu için düşürüldüyse false
+     */
+    bool post(CacheRemovalEvent event);
+
+    /**
+     * @brief Kuyruktaki tüm olaylar iletilene kadar bekler
+     */
+    void flush();
+
+    /**
+     * @brief Kuyruktaki olay sayısını döndürür
+     *
+     * @return Olay sayısı
+     */
+    size_t pending() const;
+
+    /**
+     * @brief Kuyruk kapasitesini döndürür
+     *
+     * @return Kuyruk kapasitesi
+     */
+    size_t getQueueCapacity() const;
+
+    /**
+     * @brief Kuyruk kapasitesini ayarlar
+     *
+     * @param queueCapacity Kuyruk kapasitesi
+     */
+    void setQueueCapacity(size_t queueCapacity);
+
+private:
+    using ListenerList = std::vector<std::pair<size_t, CacheRemovalListener>>;
+
+    /**
+     * @brief İletim döngüsü
+     */
+    void run();
+
+    std::shared_ptr<const ListenerList> listeners_; // Dinleyiciler (yazarken kopyalanır)
+    std::atomic<bool> hasListeners_;     // Dinleyici var mı?
+    size_t nextListenerId_;              // Sonraki dinleyici kimliği
+    std::mutex listenersMutex_;          // Dinleyici mutex'i
+
+    std::deque<CacheRemovalEvent> queue_; // Olay kuyruğu
+    size_t queueCapacity_;               // Kuyruk kapasitesi
+    size_t inFlight_;                    // İletilmekte olan olay sayısı
+    bool running_;                       // İletim iş parçacığı çalışıyor mu?
+    bool stopping_;                      // Durdurma istendi mi?
+    std::thread thread_;                 // İletim iş parçacığı
+    std::condition_variable condition_;  // Yeni olay koşulu
+    std::condition_variable idle_;       // Boş kuyruk koşulu
+    mutable std::mutex mutex_;           // Kuyruk mutex'i
+};
+
+} // namespace data
+} // namespace alt_las
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include "data/data_cache.h"
+
+namespace alt_las {
+namespace data {
+
+/**
+ * @brief Adlandırılmış önbellek örnekleri kaydı
+ *
+ * Her örneğin kendi kapasitesi, yaşam süresi, tahliye politikası, parça sayısı,
+ * kilitleri ve istatistikleri vardır; bir alt sistemin girdileri diğerininkileri
+ * tahliye etmez. Örnekler kayıttan çıkarıldıktan sonra son referansla birlikte
+ * yok edilir. Sınıf iş parçacığı güvenlidir.
+ */
+class CacheRegistry {
+public:
+    /**
+     * @brief Singleton örneğini döndürür
+     *
+     * @return CacheRegistry örneği
+     */
+    static CacheRegistry& getInstance();
+
+    /**
+     * @brief Yeni önbellek örneği oluşturur
+     *
+     * @param name Örnek adı
+     * @param config Yapılandırma
+     * @return Önbellek, aynı adda örnek varsa nullptr
+     */
+    std::shared_ptr<DataCache> create(const std::string& name, const CacheConfig& config = CacheConfig());
+
+    /**
+     * @brief Önbellek örneğini döndürür, yoksa oluşturur
+     *
+     * Örnek zaten varsa yapılandırma yok sayılır.
+     *
+     * @param name Örnek adı
+     * @param config Yapılandırma
+     * @return Önbellek
+     */
+    std::shared_ptr<DataCache> getOrCreate(const std::string& name, const CacheConfig& config = CacheConfig());
+
+    /**
+     * @brief Önbellek örneğini döndürür
+     *
+     * @param name Örnek adı
+     * @return Önbellek, yoksa nullptr
+     */
+    std::shared_ptr<DataCache> get(const std::string& name) const;
+
+    /**
+     * @brief Önbellek örneğini kayıttan çıkarır
+     *
+     * @param name Örnek adı
+     * @return Örnek bulunduysa true, değilse false
+     */
+    bool remove(const std::string& name);
+
+    /**
+     * @brief Kayıtlı örneklerin adlarını döndürür
+     *
+     * @return Sıralı örnek adları
+     */
+    std::vector<std::string> getNames() const;
+
+    /**
+     * @brief Kayıtlı örnek sayısını döndürür
+     *
+     * @return Örnek sayısı
+     */
+    size_t size() const;
+
+private:
+    /**
+     * @brief Yapıcı
+     */
+    CacheRegistry();
+
+    /**
+     * @brief Kopyalama yapıcısı (engellendi)
+     */
+    CacheRegistry(const CacheRegistry&) = delete;
+
+    /**
+     * @brief Atama operatörü (engellendi)
+     */
+    CacheRegistry& operator=(const CacheRegistry&) = delete;
+
+    std::map<std::string, std::shared_ptr<DataCache>> caches_; // Ada göre önbellekler
+    mutable std::mutex mutex_; // Kayıt mutex'i
+};
+
+} // namespace data
+} // namespace alt_las
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "data/cache_snapshot.h"
+
+namespace alt_las {
+namespace data {
+
+constexpr char kCacheSharedMagic[4] = {'A', 'L', 'S', 'M'}; // Paylaşımlı segment imzası
+constexpr uint32_t kCacheSharedVersion = 1;                 // Paylaşımlı segment sürümü
+
+/**
+ * @brief Süreçler arası paylaşımlı önbellek segmenti
+ *
+ * Kayıtlar POSIX paylaşımlı belleğinde (shm_open) sabit boyutlu yuvalardan oluşan,
+ * doğrusal yoklamalı bir karma tablosunda anlık görüntü kaydı biçiminde tutulur.
+ * Aynı adla açan süreçler (çekirdek, arayüz, analiz) aynı tabloyu görür.
+ *
+ * Yazarlar, sahibi ölürse kurtarılabilen (robust) ve süreçler arası paylaşılan bir
+ * mutex ile sıralanır; kilidi tutarken ölen sürecin yarım bıraktığı yuvalar
+ * silinmiş sayılır. Okuyucular kilit almaz: her yuvanın sıra sayacı yazma
+ * sırasında tektir, okuyucu sayaç değişmediyse kopyasını geçerli sayar.
+ *
+ * Bellek düzeni (yerel bayt sırası, 64 bayt hizalı):
+ * - Başlık: "ALSM" imzası, 32 bit sürüm, 64 bit yuva sayısı (2'nin kuvveti),
+ *   64 bit yuva veri boyutu, 64 bit ilk yuvanın konumu, 64 bit dolu yuva sayısı,
+ *   32 bit hazır bayrağı ve mutex.
+ * - Yuvalar (32 bayt + yuva veri boyutu): 32 bit sıra sayacı, 32 bit durum
+ *   (0 boş, 1 dolu, 2 silinmiş), anahtarın 64 bit FNV-1a karması, 64 bit sona
+ *   erme zamanı (system_clock döneminden bu yana milisaniye, -1 süresiz), 32 bit
+ *   kayıt uzunluğu, 32 bit boşluk ve encodeCacheSnapshotRecord ile kodlanmış kayıt.
+ *
+ * Segment, onu kullanan süreçlerden bağımsızdır; unlink() ile silinir.
+ * Sınıf iş parçacığı güvenlidir. Robust mutex desteklemeyen sistemlerde
+ * segment açılmaz ve isOpen() false döndürür.
+ */
+class CacheSharedSegment {
+public:
+    /**
+     * @brief Yapıcı
+     *
+     * Segment yoksa oluşturulur; varsa yuva sayısı ve boyutu segmentten okunur.
+     *
+     * @param name Segment adı (ör. "/alt_las_cache")
+     * @param slotCount Yuva sayısı (2'nin kuvvetine yuvarlanır)
+     * @param slotSize Yuva başına en büyük kayıt boyutu (bayt)
+     */
+    CacheSharedSegment(const std::string& name, size_t slotCount, size_t slotSize);
+
+    /**
+     * @brief Yıkıcı
+     */
+    ~CacheSharedSegment();
+
+    /**
+     * @brief Kopyalama yapıcısı (engellendi)
+     */
+    CacheSharedSegment(const CacheSharedSegment&) = delete;
+
+    /**
+     * @brief Atama operatörü (engellendi)
+     */
+    CacheSharedSegment& operator=(const CacheSharedSegment&) = delete;
+
+    /**
+     * @brief Segmentin açık olup olmadığını kontrol eder
+     *
+     * @return Segment açıksa true, değilse false
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Kaydı yazar
+     *
+     * Aynı anahtarlı kaydın yerine, yoksa silinmiş veya süresi dolmuş bir yuvaya,
+     * yoksa boş yuvaya yazılır.
+     *
+     * @param record Kayıt
+     * @param nowMs Şimdiki zaman (system_clock döneminden bu yana milisaniye)
+     * @return Yazıldıysa true, kayıt yuvaya sığmıyorsa veya tablo doluysa false
+     */
+    bool put(const CacheSnapshotRecord& record, int64_t nowMs);
+
+    /**
+     * @brief Kodlanmış kaydı yazar
+     *
+     * Kayıt, çağıranın kilitleri dışında yazılabilsin diye önceden kodlanır.
+     *
+     * @param key Anahtar
+     * @param expiresAtMs Sona erme zamanı (milisaniye), süresizse -1
+     * @param bytes encodeCacheSnapshotRecord ile kodlanmış kayıt
+     * @param nowMs Şimdiki zaman (system_clock döneminden bu yana milisaniye)
+     * @return Yazıldıysa true, kayıt yuvaya sığmıyorsa veya tablo doluysa false
+     */
+    bool put(std::string_view key, int64_t expiresAtMs, std::string_view bytes, int64_t nowMs);
+
+    /**
+     * @brief Kaydı okur
+     *
+     * @param key Anahtar
+     * @param nowMs Şimdiki zaman (system_clock döneminden bu yana milisaniye)
+     * @param buffer Kayıt baytları için tampon
+     * @param record Okunan kayıt (alanlar tamponu gösterir)
+     * @return Geçerli kayıt bulunduysa true, değilse false
+     */
+    bool get(std::string_view key, int64_t nowMs, std::string& buffer, CacheSnapshotRecord& record) const;
+
+    /**
+     * @brief Kaydı siler
+     *
+     * @param key Anahtar
+     * @return Kayıt bulunduysa true, değilse false
+     */
+    bool remove(std::string_view key);
+
+    /**
+     * @brief Tüm etiketleri taşıyan kayıtları siler
+     *
+     * @param tags Sıralı etiketler
+     * @return Silinen kayıt sayısı
+     */
+    size_t removeByTags(const std::vector<std::string>& tags);
+
+    /**
+     * @brief Tüm kayıtları siler
+     */
+    void clear();
+
+    /**
+     * @brief Dolu yuva sayısını döndürür
+     *
+     * @return Dolu yuva sayısı (süresi dolmuşlar dahil)
+     */
+    size_t size() const;
+
+    /**
+     * @brief Yuva sayısını döndürür
+     *
+     * @return Yuva sayısı
+     */
+    size_t slotCount() const;
+
+    /**
+     * @brief Yuva başına en büyük kayıt boyutunu döndürür
+     *
+     * @return Kayıt boyutu (bayt)
+     */
+    size_t slotSize() const;
+
+    /**
+     * @brief Segmenti sistemden siler
+     *
+     * Segmenti açmış süreçler eşlemelerini kapatana kadar kullanmaya devam eder.
+     *
+     * @param name Segment adı
+     * @return Silindiyse true, değilse false
+     */
+    static bool unlink(const std::string& name);
+
+    static constexpr size_t kDefaultSlotCount = 4096; // Varsayılan yuva sayısı
+    static constexpr size_t kDefaultSlotSize = 4096;  // Varsayılan yuva kayıt boyutu
+
+private:
+    struct Header;
+    struct Slot;
+
+    /**
+     * @brief Yazma kilidini alır; ölen sahibin yarım bıraktığı yuvaları temizler
+     *
+     * @return Kilit alındıysa true, değilse false
+     */
+    bool lock();
+
+    /**
+     * @brief Yazma kilidini bırakır
+     */
+    void unlock();
+
+    /**
+     * @brief Yuvayı döndürür
+     *
+     * @param index Yuva indeksi
+     * @return Yuva
+     */
+    Slot* slotAt(size_t index) const;
+
+    /**
+     * @brief Dolu yuvanın anahtarı taşıyıp taşımadığını kontrol eder (kilit tutulurken çağrılır)
+     *
+     * @param slot Yuva
+     * @param hash Anahtarın karması
+     * @param key Anahtar
+     * @return Aynı anahtarsa true, değilse false
+     */
+    bool hasKey(const Slot* slot, uint64_t hash, std::string_view key) const;
+
+    /**
+     * @brief Yuvaya kayıt yazar (kilit tutulurken çağrılır)
+     *
+     * @param slot Yuva
+     * @param state Yeni durum
+     * @param hash Anahtarın karması
+     * @param expiresAtMs Sona erme zamanı
+     * @param bytes Kayıt baytları
+     */
+    void writeSlot(Slot* slot, uint32_t state, uint64_t hash, int64_t expiresAtMs, std::string_view bytes);
+
+    std::string name_;      // Segment adı
+    void* address_;         // Eşlenen bellek
+    size_t mappedSize_;     // Eşlenen boyut
+    Header* header_;        // Segment başlığı
+    size_t slotStride_;     // Yuvalar arası uzaklık (bayt)
+};
+
+} // namespace data
+} // namespace alt_las
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <type_traits>
+
+namespace alt_las {
+namespace data {
+
+/**
+ * @brief Önbellek değer boyutu tahmincisi
+ *
+ * Önbellek bellek bütçesi için değerin kapladığı yaklaşık bayt sayısını döndürür.
+ * Varsayılan tahmin sizeof(T)'dir; yığında bellek tutan türler için özelleştirilmelidir.
+ */
+template <typename T, typename Enable = void>
+struct CacheSizeEstimator {
+    static size_t estimate(const T&) {
+        return sizeof(T);
+    }
+};
+
+/**
+ * @brief std::string için boyut tahmincisi
+ */
+template <>
+struct CacheSizeEstimator<std::string> {
+    static size_t estimate(const std::string& value) {
+        return sizeof(std::string) + value.capacity();
+    }
+};
+
+/**
+ * @brief std::vector için boyut tahmincisi
+ */
+template <typename U, typename Allocator>
+struct CacheSizeEstimator<std::vector<U, Allocator>> {
+    static size_t estimate(const std::vector<U, Allocator>& value) {
+        size_t size = sizeof(value) + (value.capacity() - value.size()) * sizeof(U);
+
+        if (std::is_trivially_copyable<U>::value) {
+            return size + value.size() * sizeof(U);
+        }
+
+        // Elemanların kendi yığın belleğini de say
+        for (const auto& element : value) {
+            size += CacheSizeEstimator<U>::estimate(element);
+        }
+
+        return size;
+    }
+};
+
+/**
+ * @brief std::shared_ptr için boyut tahmincisi
+ *
+ * İşaret edilen değer, paylaşılsa da önbelleğe ait sayılır.
+ */
+template <typename U>
+struct CacheSizeEstimator<std::shared_ptr<U>> {
+    static size_t estimate(const std::shared_ptr<U>& value) {
+        return sizeof(value) + (value ? CacheSizeEstimator<typename std::remove_const<U>::type>::estimate(*value) : 0);
+    }
+};
+
+/**
+ * @brief Değerin tahmini boyutunu döndürür
+ *
+ * @param value Değer
+ * @return Tahmini boyut (bayt)
+ */
+template <typename T>
+size_t estimateCacheSize(const T& value) {
+    return CacheSizeEstimator<T>::estimate(value);
+}
+
+} // namespace data
+} // namespace alt_las
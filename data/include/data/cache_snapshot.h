@@ -0,0 +1,210 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <any>
+#include <memory>
+#include <functional>
+#include <fstream>
+#include <cstdint>
+#include <cstddef>
+#include <nlohmann/json.hpp>
+#include "data/cache_size.h"
+
+namespace alt_las {
+namespace data {
+
+constexpr char kCacheSnapshotMagic[4] = {'A', 'L', 'C', 'S'}; // Anlık görüntü dosya imzası
+constexpr uint32_t kCacheSnapshotVersion = 1;                 // Anlık görüntü dosya sürümü
+
+/**
+ * @brief Önbellek anlık görüntü türü kodlayıcısı
+ *
+ * std::any içindeki değeri MessagePack baytlarına dönüştürür ve geri çözer.
+ * Tür adı dosyaya yazılır; yükleme sırasında kodlayıcı bu adla bulunur.
+ */
+struct CacheSnapshotCodec {
+    std::string name;                                            // Tür adı
+    std::function<std::string(const std::any&)> encode;          // Değeri kodlar
+    std::function<std::any(std::string_view)> decode;            // Değeri çözer
+    std::function<size_t(const std::any&)> estimate;             // Değerin boyutunu tahmin eder
+};
+
+/**
+ * @brief nlohmann::json ile dönüştürülebilen tür için kodlayıcı oluşturur
+ *
+ * @param name Tür adı
+ * @return Kodlayıcı
+ */
+template <typename T>
+std::shared_ptr<const CacheSnapshotCodec> makeCacheSnapshotCodec(const std::string& name) {
+    auto codec = std::make_shared<CacheSnapshotCodec>();
+    codec->name = name;
+
+    codec->encode = [](const std::any& value) {
+        std::string bytes;
+        nlohmann::json::to_msgpack(nlohmann::json(std::any_cast<const T&>(value)), bytes);
+        return bytes;
+    };
+
+    codec->decode = [](std::string_view bytes) {
+        return std::any(nlohmann::json::from_msgpack(bytes.data(), bytes.data() + bytes.size()).get<T>());
+    };
+
+    codec->estimate = [](const std::any& value) {
+        return estimateCacheSize(std::any_cast<const T&>(value));
+    };
+
+    return codec;
+}
+
+/**
+ * @brief Önbellek anlık görüntü kaydı
+ *
+ * Dizge alanları okuyucunun veya çağıranın belleğini gösterir; kopyalanmaz.
+ * Zamanlar system_clock döneminden bu yana milisaniyedir; yeniden başlatma
+ * sırasında geçen süre de sayılır. -1 süresiz anlamına gelir.
+ */
+struct CacheSnapshotRecord {
+    std::string_view key;       // Anahtar
+    std::string_view type;      // Tür adı
+    std::string_view tags;      // Etiketler (virgülle ayrılmış)
+    std::string_view payload;   // Kodlanmış değer
+    int64_t ttlSeconds = 0;     // Özgün yaşam süresi (saniye)
+    int64_t expiresAtMs = -1;   // Sona erme zamanı (sert TTL)
+    int64_t staleAtMs = -1;     // Bayatlama zamanı (yumuşak TTL)
+};
+
+/**
+ * @brief Kaydı ikili biçime kodlar ve tampona ekler
+ *
+ * Kayıt uzunluk önekli anahtar, tür ve etiket alanları, üç adet 64 bit süre ve
+ * uzunluk önekli değerden oluşur. Sayılar yerel bayt sırasıyla yazılır.
+ *
+ * @param record Kayıt
+ * @param out Tampon
+ */
+void encodeCacheSnapshotRecord(const CacheSnapshotRecord& record, std::string& out);
+
+/**
+ * @brief İkili biçimdeki kaydı çözer
+ *
+ * Kayıt alanları data'yı gösterir. Kayıt yarım kalmışsa offset değişmez.
+ *
+ * @param data Kodlanmış veri
+ * @param offset Okuma konumu, başarılı okumadan sonra kaydın sonu
+ * @param record Çözülen kayıt
+ * @return Kayıt çözüldüyse true, değilse false
+ */
+bool decodeCacheSnapshotRecord(std::string_view data, size_t& offset, CacheSnapshotRecord& record);
+
+/**
+ * @brief Önbellek anlık görüntü dosyası yazıcısı
+ *
+ * Dosya biçimi: 4 baytlık "ALCS" imzası, 32 bit sürüm ve encodeCacheSnapshotRecord
+ * ile kodlanmış ardışık kayıtlar. Dosya aynı makinede yeniden başlatma için
+ * tasarlanmıştır. Yazma geçici dosyaya yapılır ve
+ * commit() ile hedef dosyanın yerine taşınır.
+ */
+class CacheSnapshotWriter {
+public:
+    /**
+     * @brief Yapıcı
+     *
+     * @param path Dosya yolu
+     */
+    explicit CacheSnapshotWriter(const std::string& path);
+
+    /**
+     * @brief Dosyanın yazmaya hazır olup olmadığını kontrol eder
+     *
+     * @return Dosya açıksa true, değilse false
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Kaydı yazar
+     *
+     * @param record Kayıt
+     */
+    void write(const CacheSnapshotRecord& record);
+
+    /**
+     * @brief Dosyayı kapatır ve hedef dosyanın yerine taşır
+     *
+     * @return Başarılıysa true, değilse false
+     */
+    bool commit();
+
+private:
+    std::string path_;     // Hedef dosya yolu
+    std::string tempPath_; // Geçici dosya yolu
+    std::ofstream file_;   // Geçici dosya
+    std::string buffer_;   // Kayıt tamponu
+};
+
+/**
+ * @brief Önbellek anlık görüntü dosyası okuyucusu
+ *
+ * POSIX sistemlerde dosya belleğe eşlenir (mmap) ve kayıtlar kopyalanmadan
+ * okunur; diğer sistemlerde dosya tek seferde belleğe okunur.
+ */
+class CacheSnapshotReader {
+public:
+    /**
+     * @brief Yapıcı
+     *
+     * @param path Dosya yolu
+     */
+    explicit CacheSnapshotReader(const std::string& path);
+
+    /**
+     * @brief Yıkıcı
+     */
+    ~CacheSnapshotReader();
+
+    /**
+     * @brief Kopyalama yapıcısı (engellendi)
+     */
+    CacheSnapshotReader(const CacheSnapshotReader&) = delete;
+
+    /**
+     * @brief Atama operatörü (engellendi)
+     */
+    CacheSnapshotReader& operator=(const CacheSnapshotReader&) = delete;
+
+    /**
+     * @brief Dosyanın geçerli bir anlık görüntü olup olmadığını kontrol eder
+     *
+     * @return Dosya açıldıysa ve başlığı geçerliyse true, değilse false
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Dosyanın belleğe eşlenip eşlenmediğini kontrol eder
+     *
+     * @return Dosya eşlendiyse true, değilse false
+     */
+    bool isMapped() const;
+
+    /**
+     * @brief Sonraki kaydı okur
+     *
+     * Kayıt alanları okuyucu yaşadığı sürece geçerlidir. Yarım kalmış son kayıt yok sayılır.
+     *
+     * @param record Okunan kayıt
+     * @return Kayıt okunduysa true, dosya bittiyse false
+     */
+    bool next(CacheSnapshotRecord& record);
+
+private:
+    const char* data_;   // Dosya içeriği
+    size_t size_;        // Dosya boyutu
+    size_t offset_;      // Okuma konumu
+    bool mapped_;        // Dosya belleğe eşlendi mi?
+    bool open_;          // Başlık geçerli mi?
+    std::string buffer_; // Eşleme yapılamadığında dosya içeriği
+};
+
+} // namespace data
+} // namespace alt_las
@@ -0,0 +1,253 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <map>
+#include <memory>
+#include <fstream>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include "data/cache_snapshot.h"
+#include "data/maintenance_scheduler.h"
+
+namespace alt_las {
+namespace data {
+
+/**
+ * @brief Önbellek disk taşma katmanı
+ *
+ * Bellekten tahliye edilen girdiler, anlık görüntü kaydı biçiminde yalnızca
+ * sona eklenen bir segment dosyasına yazılır. Anahtarların dosyadaki konumları
+ * bellekteki dizinde tutulur. Okunan, silinen veya üzerine yazılan kayıtlar
+ * dosyada ölü bayt olarak kalır; ölü baytlar canlı baytları aştığında segment
+ * bakım zamanlayıcısının iş havuzunda sıkıştırılır. Canlı baytlar bütçeyi aşarsa
+ * en eski kayıtlar düşürülür.
+ *
+ * Yazma iki adımdadır: reserve() dizinde anahtar için yer ayırır (dosyaya
+ * dokunmaz), write() kaydı dosyaya ekler. Arada anahtar silinir veya yeniden
+ * ayrılırsa yazma yok sayılır; böylece önbellek kaydı kendi kilidi dışında
+ * yazabilir ve eski bir değer yeni yazmaları ezmez. Dizindeki anahtarlar bir
+ * sayaç süzgecinde de tutulur; süzgeçte bulunmayan anahtarlar için take(),
+ * contains() ve remove() kilit almadan döner.
+ * Dosya süreç başına geçicidir; açılırken sıfırlanır, kapanırken silinir.
+ * Sınıf iş parçacığı güvenlidir.
+ */
+class CacheSpillStore {
+public:
+    /**
+     * @brief Yapıcı
+     *
+     * @param path Segment dosyası yolu
+     * @param byteBudget Canlı kayıtlar için bayt bütçesi, 0 ise sınırsız
+     */
+    CacheSpillStore(const std::string& path, size_t byteBudget);
+
+    /**
+     * @brief Yıkıcı
+     */
+    ~CacheSpillStore();
+
+    /**
+     * @brief Kopyalama yapıcısı (engellendi)
+     */
+    CacheSpillStore(const CacheSpillStore&) = delete;
+
+    /**
+     * @brief Atama operatörü (engellendi)
+     */
+    CacheSpillStore& operator=(const CacheSpillStore&) = delete;
+
+    /**
+     * @brief Segment dosyasının açık olup olmadığını kontrol eder
+     *
+     * @return Dosya açıksa true, değilse false
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Anahtar için dizinde yer ayırır
+     *
+     * Aynı anahtarın eski kaydı ölü sayılır. Kayıt write() ile yazılana kadar
+     * anahtar segmentte yokmuş gibi davranılır.
+     *
+     * @param key Anahtar
+     * @param expiresAtMs Sona erme zamanı, -1 ise süresiz
+     * @param tags Ayrıştırılmış etiketler
+     * @return Yazmada kullanılacak bilet
+     */
+    uint64_t reserve(std::string_view key, int64_t expiresAtMs, const std::vector<std::string>& tags);
+
+    /**
+     * @brief Ayrılan yere kodlanmış kaydı yazar
+     *
+     * @param key Anahtar
+     * @param ticket reserve() ile alınan bilet
+     * @param bytes encodeCacheSnapshotRecord ile kodlanmış kayıt
+     * @return Yazıldıysa true, yer bu arada silindiyse veya yazma başarısızsa false
+     */
+    bool write(std::string_view key, uint64_t ticket, const std::string& bytes);
+
+    /**
+     * @brief Kaydı segmentten okur ve dizinden çıkarır
+     *
+     * Kayıt alanları buffer'ı gösterir.
+     *
+     * @param key Anahtar
+     * @param buffer Kayıt tamponu
+     * @param record Okunan kayıt
+     * @return Kayıt bulunduysa true, değilse false
+     */
+    bool take(std::string_view key, std::string& buffer, CacheSnapshotRecord& record);
+
+    /**
+     * @brief Anahtarın süresi dolmamış bir kaydı olup olmadığını kontrol eder
+     *
+     * @param key Anahtar
+     * @param nowMs Şimdiki zaman (system_clock döneminden bu yana milisaniye)
+     * @return Kayıt varsa true, yoksa false
+     */
+    bool contains(std::string_view key, int64_t nowMs) const;
+
+    /**
+     * @brief Anahtarın kaydını dizinden çıkarır
+     *
+     * @param key Anahtar
+     * @return Kayıt çıkarıldıysa true, değilse false
+     */
+    bool remove(std::string_view key);
+
+    /**
+     * @brief Tüm etiketleri taşıyan kayıtları dizinden çıkarır
+     *
+     * @param tags Sıralı etiketler
+     * @return Çıkarılan kayıt sayısı
+     */
+    size_t removeByTags(const std::vector<std::string>& tags);
+
+    /**
+     * @brief Tüm kayıtları siler ve segmenti sıfırlar
+     */
+    void clear();
+
+    /**
+     * @brief Kayıt sayısını döndürür
+     *
+     * @return Kayıt sayısı
+     */
+    size_t size() const;
+
+    /**
+     * @brief Canlı kayıtların toplam boyutunu döndürür
+     *
+     * @return Canlı baytlar
+     */
+    size_t bytes() const;
+
+    /**
+     * @brief Segment dosyasının boyutunu döndürür
+     *
+     * @return Dosya boyutu (bayt)
+     */
+    size_t fileSize() const;
+
+    /**
+     * @brief Sıkıştırma sayısını döndürür
+     *
+     * @return Sıkıştırma sayısı
+     */
+    size_t compactions() const;
+
+    /**
+     * @brief Bayt bütçesini döndürür
+     *
+     * @return Bayt bütçesi
+     */
+    size_t getByteBudget() const;
+
+    /**
+     * @brief Bayt bütçesini ayarlar
+     *
+     * @param byteBudget Bayt bütçesi, 0 ise sınırsız
+     */
+    void setByteBudget(size_t byteBudget);
+
+    static constexpr size_t kMinCompactionBytes = 64 * 1024; // Sıkıştırma için en küçük dosya boyutu
+    static constexpr size_t kFilterSize = 1 << 16;           // Anahtar süzgecindeki sayaç sayısı
+
+private:
+    /**
+     * @brief Kaydın segmentteki konumu
+     */
+    struct Slot {
+        std::string key;                // Anahtar (dizin anahtarı bu dizgeyi gösterir)
+        uint64_t ticket;                // Ayırma bileti
+        bool written;                   // Kayıt dosyaya yazıldı mı?
+        uint64_t offset;                // Dosyadaki konum
+        uint32_t length;                // Kayıt uzunluğu
+        int64_t expiresAtMs;            // Sona erme zamanı, -1 ise süresiz
+        std::vector<std::string> tags;  // Etiketler (sıralı)
+    };
+
+    using SlotMap = std::unordered_map<std::string_view, std::unique_ptr<Slot>>;
+
+    /**
+     * @brief Anahtarın süzgeç sayacını döndürür
+     *
+     * @param key Anahtar
+     * @return Sayaç
+     */
+    std::atomic<uint32_t>& filterCounter(std::string_view key) const;
+
+    /**
+     * @brief Anahtarın dizinde olabileceğini kontrol eder (kilit almaz)
+     *
+     * @param key Anahtar
+     * @return Olabilirse true, kesinlikle yoksa false
+     */
+    bool mayContain(std::string_view key) const;
+
+    /**
+     * @brief Kaydı dizinden çıkarır (kilit tutulurken çağrılır)
+     *
+     * @param it Kayıt
+     */
+    void dropSlot(SlotMap::iterator it);
+
+    /**
+     * @brief Bütçeyi ve ölü baytları kontrol eder, gerekirse sıkıştırmayı planlar (kilit tutulurken çağrılır)
+     */
+    void checkBudget();
+
+    /**
+     * @brief Canlı kayıtları yeni segmente kopyalar (iş havuzunda, kilit tutulmadan çağrılır)
+     *
+     * Kayıtlar kilit dışında kopyalanır; kilit yalnızca kopyalama sırasında
+     * eklenen kayıtları taşımak ve konumları güncellemek için alınır.
+     *
+     * @return Sıkıştırma başarılıysa true, değilse false
+     */
+    bool compact();
+
+    std::string path_;                   // Segment dosyası yolu
+    std::fstream file_;                  // Segment dosyası
+    SlotMap index_;                      // Anahtar dizini
+    std::map<uint64_t, std::string_view> order_; // Konuma göre (en eskiden) yazılmış kayıtların anahtarları
+    std::unique_ptr<std::atomic<uint32_t>[]> filter_; // Dizindeki anahtarların sayaç süzgeci
+    size_t byteBudget_;                  // Bayt bütçesi
+    size_t liveBytes_;                   // Canlı baytlar
+    size_t fileSize_;                    // Dosya boyutu
+    size_t compactions_;                 // Sıkıştırma sayısı
+    uint64_t nextTicket_;                // Sonraki ayırma bileti
+    uint64_t generation_;                // Segment sıfırlandıkça artar
+    bool compacting_;                    // Sıkıştırma planlandı veya sürüyor mu?
+    MaintenanceScheduler::TaskId compactionTask_; // Son sıkıştırma görevi
+    MaintenanceScheduler& scheduler_;    // Sıkıştırmayı çalıştıran zamanlayıcı
+    mutable std::mutex mutex_;           // Segment mutex'i
+};
+
+} // namespace data
+} // namespace alt_las
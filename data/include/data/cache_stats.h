@@ -0,0 +1,128 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <atomic>
+#include <cstddef>
+
+namespace alt_las {
+namespace data {
+
+/**
+ * @brief Önbellek istatistik sayacı
+ */
+enum class CacheStat : size_t {
+    HIT,                // Bulunan girdi
+    MISS,               // Bulunamayan girdi
+    SET,                // Ekleme
+    REMOVE,             // Silme
+    CLEAR,              // Temizleme
+    CLEAR_EXPIRED,      // Süresi dolmuşları temizleme
+    CLEAR_BY_TAGS,      // Etiketlere göre temizleme
+    EXPIRED,            // Süresi dolmuş girdi
+    CAST_ERROR,         // Tür dönüşüm hatası
+    CAPACITY_EXCEEDED,  // Kapasite aşımı
+    LOAD,               // Yükleyici çağrısı
+    LOAD_SAVED,         // Tek uçuşla önlenen yükleyici çağrısı
+    STALE_HIT,          // Bayat değer döndüren okuma
+    REFRESH,            // Arka plan yenilemesi
+    REFRESH_ERROR,      // Başarısız arka plan yenilemesi
+    SNAPSHOT_SAVED,     // Anlık görüntüye kaydedilen girdi
+    SNAPSHOT_LOADED,    // Anlık görüntüden yüklenen girdi
+    SPILL_WRITE,        // Disk taşma katmanına yazılan girdi
+    SPILL_HIT,          // Disk taşma katmanından geri alınan girdi
+    ADMISSION_REJECTED, // W-TinyLFU'nun reddettiği aday
+    LISTENER_DROPPED,   // Kuyruk dolu olduğu için düşürülen çıkarılma olayı
+    FRONT_HIT,          // İş parçacığı yerel ön önbellekte bulunan girdi
+    ENTRY_ALLOCATED,    // Bellek ayrılarak oluşturulan girdi düğümü
+    ENTRY_REUSED,       // Boş düğüm listesinden yeniden kullanılan girdi düğümü
+    COMPRESS,           // Sıkıştırılarak saklanan değer
+    DECOMPRESS,         // Okunurken açılan sıkıştırılmış değer
+    SHARED_WRITE,       // Paylaşımlı segmente yazılan girdi
+    SHARED_HIT,         // Paylaşımlı segmentten alınan girdi
+    COUNT               // Sayaç sayısı
+};
+
+/**
+ * @brief Önbellek istatistik sayaçları
+ *
+ * Sayaçlar, önbellek satırı hizalı şeritlere bölünür ve her iş parçacığı kendi
+ * şeridine kilitsiz olarak yazar. Şeritler yalnızca okunurken toplanır.
+ */
+class CacheStatCounters {
+public:
+    /**
+     * @brief Yapıcı
+     */
+    CacheStatCounters();
+
+    /**
+     * @brief Kopyalama yapıcısı (engellendi)
+     */
+    CacheStatCounters(const CacheStatCounters&) = delete;
+
+    /**
+     * @brief Atama operatörü (engellendi)
+     */
+    CacheStatCounters& operator=(const CacheStatCounters&) = delete;
+
+    /**
+     * @brief Sayacı artırır
+     *
+     * @param stat Sayaç
+     * @param count Artış miktarı
+     */
+    void add(CacheStat stat, size_t count = 1) {
+        stripes_[stripeIndex()].values[static_cast<size_t>(stat)].fetch_add(count, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Sayacın toplam değerini döndürür
+     *
+     * @param stat Sayaç
+     * @return Sayaç değeri
+     */
+    size_t get(CacheStat stat) const;
+
+    /**
+     * @brief Tüm sayaçları sıfırlar
+     */
+    void reset();
+
+    /**
+     * @brief Sayaçları ad-değer haritası olarak döndürür
+     *
+     * @return İstatistikler
+     */
+    std::unordered_map<std::string, size_t> snapshot() const;
+
+    /**
+     * @brief Sayacın adını döndürür
+     *
+     * @param stat Sayaç
+     * @return Sayaç adı
+     */
+    static const char* getName(CacheStat stat);
+
+    static constexpr size_t kStripeCount = 16; // Şerit sayısı
+
+private:
+    /**
+     * @brief Önbellek satırı hizalı sayaç şeridi
+     */
+    struct alignas(64) Stripe {
+        std::atomic<size_t> values[static_cast<size_t>(CacheStat::COUNT)];
+    };
+
+    /**
+     * @brief Çağıran iş parçacığının şerit indeksini döndürür
+     *
+     * @return Şerit indeksi
+     */
+    static size_t stripeIndex();
+
+    Stripe stripes_[kStripeCount]; // Sayaç şeritleri
+};
+
+} // namespace data
+} // namespace alt_las
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <cstddef>
+
+namespace alt_las {
+namespace data {
+
+/**
+ * @brief Etiket dizgesini ayrıştırır
+ *
+ * Etiketler virgül, noktalı virgül veya boşlukla ayrılır. Sonuç sıralı ve tekrarsızdır.
+ *
+ * @param tags Etiket dizgesi (ör. "screen,ui")
+ * @return Etiketler
+ */
+std::vector<std::string> parseCacheTags(const std::string& tags);
+
+/**
+ * @brief Etiket dizini
+ *
+ * Etiketten anahtarlara ters dizindir; bir etikete göre temizleme yalnızca
+ * eşleşen girdiler kadar maliyetlidir.
+ * Sınıf iş parçacığı güvenli değildir; çağıran, sahibi olan parçanın kilidini tutmalıdır.
+ */
+template <typename Key, typename Hash = std::hash<Key>>
+class TagIndex {
+public:
+    using KeySet = std::unordered_set<Key, Hash>;
+
+    /**
+     * @brief Anahtarı etiketlerine ekler
+     *
+     * @param key Anahtar
+     * @param tags Etiketler
+     */
+    void add(const Key& key, const std::vector<std::string>& tags) {
+        for (const auto& tag : tags) {
+            index_[tag].insert(key);
+        }
+    }
+
+    /**
+     * @brief Anahtarı etiketlerinden çıkarır
+     *
+     * @param key Anahtar
+     * @param tags Etiketler
+     */
+    void remove(const Key& key, const std::vector<std::string>& tags) {
+        for (const auto& tag : tags) {
+            auto it = index_.find(tag);
+            if (it == index_.end()) {
+                continue;
+            }
+
+            it->second.erase(key);
+            if (it->second.empty()) {
+                index_.erase(it);
+            }
+        }
+    }
+
+    /**
+     * @brief Etiketi taşıyan anahtarları döndürür
+     *
+     * @param tag Etiket
+     * @return Anahtarlar, etiket yoksa nullptr
+     */
+    const KeySet* find(const std::string& tag) const {
+        auto it = index_.find(tag);
+        return it == index_.end() ? nullptr : &it->second;
+    }
+
+    /**
+     * @brief Tüm etiketleri taşıyan anahtarları döndürür
+     *
+     * En az anahtara sahip etiketin kümesi taranır.
+     *
+     * @param tags Etiketler
+     * @param hasTag Anahtarın bir etiketi taşıyıp taşımadığını bildiren fonksiyon
+     * @return Anahtarlar
+     */
+    template <typename Predicate>
+    std::vector<Key> match(const std::vector<std::string>& tags, Predicate&& hasTag) const {
+        std::vector<Key> keys;
+        const KeySet* smallest = nullptr;
+
+        for (const auto& tag : tags) {
+            const KeySet* set = find(tag);
+            if (set == nullptr) {
+                return keys;
+            }
+            if (smallest == nullptr || set->size() < smallest->size()) {
+                smallest = set;
+            }
+        }
+
+        if (smallest == nullptr) {
+            return keys;
+        }
+
+        for (const auto& key : *smallest) {
+            bool all = true;
+            for (const auto& tag : tags) {
+                if (!hasTag(key, tag)) {
+                    all = false;
+                    break;
+                }
+            }
+            if (all) {
+                keys.push_back(key);
+            }
+        }
+
+        return keys;
+    }
+
+    /**
+     * @brief Dizini boşaltır
+     */
+    void clear() {
+        index_.clear();
+    }
+
+private:
+    std::unordered_map<std::string, KeySet> index_; // Etiket -> anahtarlar
+};
+
+} // namespace data
+} // namespace alt_las
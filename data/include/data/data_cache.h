@@ -1,12 +1,36 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <memory>
 #include <mutex>
+#include <atomic>
+#include <vector>
 #include <chrono>
 #include <functional>
 #include <any>
+#include <optional>
+#include <algorithm>
+#include <numeric>
+#include <typeindex>
+#include <future>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+#include "data/cache_admission.h"
+#include "data/cache_clock.h"
+#include "data/cache_compression.h"
+#include "data/cache_eviction.h"
+#include "data/cache_expiry.h"
+#include "data/cache_listener.h"
+#include "data/cache_size.h"
+#include "data/cache_snapshot.h"
+#include "data/cache_spill.h"
+#include "data/cache_shared.h"
+#include "data/cache_stats.h"
+#include "data/cache_tags.h"
+#include "data/maintenance_scheduler.h"
 
 namespace alt_las {
 namespace data {
@@ -14,18 +38,194 @@ namespace data {
 /**
  * @brief Önbellek girdisi
  */
-struct CacheEntry {
+struct CacheEntry : EvictionHook {
+    std::string key;                                    // Anahtar (harita anahtarı bu dizgeyi gösterir)
     std::any data;                                      // Önbellek verisi
-    std::chrono::system_clock::time_point createdAt;    // Oluşturulma zamanı
-    std::chrono::system_clock::time_point expiresAt;    // Sona erme zamanı
+    CoarseClock::time_point createdAt;                  // Oluşturulma zamanı
+    CoarseClock::time_point expiresAt;                  // Sona erme zamanı (sert TTL)
+    CoarseClock::time_point staleAt;                    // Bayatlama zamanı (yumuşak TTL)
     std::chrono::seconds ttl;                           // Yaşam süresi
-    std::string tags;                                   // Etiketler
+    std::vector<std::string> tags;                      // Etiketler (sıralı)
+    size_t size = 0;                                    // Tahmini boyut (değer + anahtar, bayt)
+    size_t rawSize = 0;                                 // Sıkıştırılmışsa özgün boyut, değilse 0
+    bool inWindow = false;                              // W-TinyLFU kabul penceresinde mi?
 };
 
+/**
+ * @brief Önbellek girdisi haritası
+ * 
+ * Harita anahtarı, girdinin kendi anahtar dizgesini gösteren std::string_view'dır.
+ * Böylece std::string_view veya dizge sabitiyle yapılan aramalar geçici dizge oluşturmaz.
+ */
+using CacheEntryMap = std::unordered_map<std::string_view, std::unique_ptr<CacheEntry>>;
+
+/**
+ * @brief Parça kilidi bırakıldıktan sonra disk taşma katmanına yazılacak kayıt
+ */
+struct PendingSpill {
+    std::string key;                                    // Anahtar
+    uint64_t ticket = 0;                                // CacheSpillStore::reserve ile alınan bilet
+    std::string bytes;                                  // Kodlanmış kayıt
+};
+
+/**
+ * @brief Parça kilidi bırakıldıktan sonra paylaşımlı segmente yazılacak kayıt
+ */
+struct PendingPublish {
+    std::string key;                                    // Anahtar
+    int64_t expiresAtMs = -1;                           // Sona erme zamanı (milisaniye), süresizse -1
+    std::string bytes;                                  // Kodlanmış kayıt
+};
+
+/**
+ * @brief Okumanın parça kilidi bırakıldıktan sonra yapılacak işleri
+ */
+struct CacheDeferredWork {
+    bool stale = false;                                 // Döndürülen değer bayat mı?
+    std::vector<PendingSpill> spills;                   // Yükseltmenin tahliye ettiği, yazılacak kayıtlar
+    
+    /**
+     * @brief Yapılacak iş olup olmadığını döndürür
+     * 
+     * @return İş yoksa true, varsa false
+     */
+    bool empty() const {
+        return !stale && spills.empty();
+    }
+};
+
+/**
+ * @brief Süren yükleme
+ */
+struct CacheLoad {
+    std::shared_future<std::any> result;                // Yükleme sonucu
+    std::thread::id leader;                             // Yüklemeyi üstlenen iş parçacığı
+};
+
+/**
+ * @brief Yenileme yükleyicisi
+ * 
+ * Yükleyici haritasının anahtarı, kaydın kendi anahtar dizgesini gösterir;
+ * böylece bayat okumalardaki denetim geçici dizge oluşturmaz.
+ */
+struct CacheRefreshLoader {
+    std::string key;                                    // Anahtar
+    std::shared_ptr<std::function<void()>> loader;      // Yükleyici
+};
+
+/**
+ * @brief Önbellek parçası
+ * 
+ * Anahtarlar, karma değerlerine göre parçalara dağıtılır. Her parçanın kendi
+ * haritası ve kilidi vardır; farklı parçalardaki anahtarlar birbirini beklemez.
+ */
+struct alignas(64) CacheShard {
+    CacheEntryMap entries;                               // Parça girdileri
+    EvictionList eviction;                               // Tahliye listesi (ana bölge)
+    EvictionList window;                                 // W-TinyLFU kabul penceresi (LRU)
+    FrequencySketch sketch;                              // Erişim sıklığı taslağı
+    ExpiryQueue<std::string> expiry;                     // Sona erme kuyruğu
+    TagIndex<std::string_view> tags;                     // Etiket dizini
+    size_t bytes = 0;                                    // Girdilerin toplam boyutu
+    size_t compressedEntries = 0;                        // Sıkıştırılmış girdi sayısı
+    size_t compressedBytes = 0;                          // Sıkıştırılmış girdilerin boyutu
+    size_t rawBytes = 0;                                 // Sıkıştırılmış girdilerin özgün boyutu
+    std::unordered_map<std::string, CacheLoad> loading;  // Süren yüklemeler
+    std::vector<CacheEntryMap::node_type> freeNodes;     // Yeniden kullanılacak boş düğümler
+    std::vector<PendingSpill> pendingSpills;             // Kilit dışında yazılacak taşma kayıtları
+    std::vector<PendingPublish> pendingPublishes;        // Kilit dışında yazılacak paylaşımlı kayıtlar
+    mutable std::mutex mutex;                            // Parça mutex'i
+    std::mutex publishMutex;                             // Paylaşımlı yazmaları sırayla yapan mutex
+    
+    /**
+     * @brief Girdinin bulunduğu tahliye listesini döndürür
+     * 
+     * @param entry Girdi
+     * @return Pencere veya ana bölge listesi
+     */
+    EvictionList& listOf(const CacheEntry& entry) {
+        return entry.inWindow ? window : eviction;
+    }
+    
+    /**
+     * @brief Girdinin boyutunu parça toplamlarına ekler
+     * 
+     * @param entry Girdi
+     */
+    void addBytes(const CacheEntry& entry) {
+        bytes += entry.size;
+        if (entry.rawSize > 0) {
+            compressedEntries++;
+            compressedBytes += entry.size;
+            rawBytes += entry.rawSize;
+        }
+    }
+    
+    /**
+     * @brief Girdinin boyutunu parça toplamlarından çıkarır
+     * 
+     * @param entry Girdi
+     */
+    void removeBytes(const CacheEntry& entry) {
+        bytes -= entry.size;
+        if (entry.rawSize > 0) {
+            compressedEntries--;
+            compressedBytes -= entry.size;
+            rawBytes -= entry.rawSize;
+        }
+    }
+    
+    /**
+     * @brief Bekleyen taşma kayıtlarını çağıranın listesine taşır
+     * 
+     * @param out Hedef liste
+     */
+    void takePendingSpills(std::vector<PendingSpill>& out) {
+        if (pendingSpills.empty()) {
+            return;
+        }
+        if (out.empty()) {
+            out.swap(pendingSpills);
+            return;
+        }
+        std::move(pendingSpills.begin(), pendingSpills.end(), std::back_inserter(out));
+        pendingSpills.clear();
+    }
+    
+    /**
+     * @brief Parça toplamlarını sıfırlar
+     */
+    void resetBytes() {
+        bytes = 0;
+        compressedEntries = 0;
+        compressedBytes = 0;
+        rawBytes = 0;
+    }
+};
+
+/**
+ * @brief Önbellek örneği yapılandırması
+ */
+struct CacheConfig {
+    size_t capacity = 1000;                                             // Kapasite (girdi sayısı)
+    size_t memoryBudget = 0;                                            // Bellek bütçesi (bayt), 0 ise sınırsız
+    size_t shardCount = 1;                                              // Parça sayısı (2'nin kuvvetine yuvarlanır)
+    std::chrono::seconds defaultTtl = std::chrono::seconds(3600);       // Varsayılan yaşam süresi
+    std::chrono::seconds cleanupInterval = std::chrono::seconds(300);   // Otomatik temizleme aralığı
+    EvictionPolicy evictionPolicy = EvictionPolicy::LRU;                // Tahliye politikası
+    CacheAdmissionPolicy admissionPolicy = CacheAdmissionPolicy::ALWAYS; // Kabul politikası
+    bool frontCache = false;                                            // İş parçacığı yerel ön önbellek etkin mi?
+    size_t compressionThreshold = 0;                                    // Sıkıştırma eşiği (bayt), 0 ise sıkıştırma yok
+};
+
+class CacheRegistry;
+
 /**
  * @brief Veri önbellekleme sınıfı
  * 
- * Bu sınıf, veri önbellekleme işlemlerini temsil eder.
+ * Bu sınıf, veri önbellekleme işlemlerini temsil eder. Süreç genelindeki örneğe
+ * getInstance() ile, kendi yapılandırmasına sahip adlandırılmış örneklere
+ * CacheRegistry ile erişilir.
  */
 class DataCache {
 public:
@@ -47,10 +247,11 @@ public:
      * @param key Anahtar
      * @param data Veri
      * @param ttl Yaşam süresi (saniye)
-     * @param tags Etiketler
+     * @param tags Etiketler (virgül, noktalı virgül veya boşlukla ayrılmış)
+     * @param size Değerin boyutu (bayt), 0 ise CacheSizeEstimator ile tahmin edilir
      */
     template <typename T>
-    void set(const std::string& key, const T& data, std::chrono::seconds ttl = std::chrono::seconds(0), const std::string& tags = "");
+    void set(std::string_view key, const T& data, std::chrono::seconds ttl = std::chrono::seconds(0), const std::string& tags = "", size_t size = 0);
 
     /**
      * @brief Önbellekten veri alır
@@ -60,7 +261,133 @@ public:
      * @return Veri
      */
     template <typename T>
-    T get(const std::string& key, const T& defaultValue = T());
+    T get(std::string_view key, const T& defaultValue = T());
+
+    /**
+     * @brief Önbellekten veri almayı dener
+     * 
+     * Varlık kontrolü ve okuma tek bir arama ve tek bir kilitle yapılır.
+     * 
+     * @param key Anahtar
+     * @param value Bulunan veri
+     * @return Veri bulunduysa true, değilse false
+     */
+    template <typename T>
+    bool tryGet(std::string_view key, T& value);
+
+    /**
+     * @brief Önbellekten birden fazla veri alır
+     * 
+     * Anahtarlar parçalarına göre gruplanır ve her parçanın kilidi bir kez alınır.
+     * 
+     * @param keys Anahtarlar (std::string_view'a dönüştürülebilen öğeler)
+     * @return Anahtarlarla aynı sırada veriler, bulunamayanlar için std::nullopt
+     */
+    template <typename T, typename Keys>
+    std::vector<std::optional<T>> getMany(const Keys& keys);
+
+    /**
+     * @brief Önbelleğe birden fazla veri ekler
+     * 
+     * Öğeler parçalarına göre gruplanır ve her parçanın kilidi bir kez alınır.
+     * Aynı anahtar birden fazla kez verilirse sonuncusu kalır.
+     * 
+     * @param items Anahtar-değer çiftleri (first: anahtar, second: değer)
+     * @param ttl Yaşam süresi (saniye)
+     * @param tags Etiketler
+     */
+    template <typename Items>
+    void setMany(const Items& items, std::chrono::seconds ttl = std::chrono::seconds(0), const std::string& tags = "");
+
+    /**
+     * @brief Önbellekten birden fazla veri siler
+     * 
+     * @param keys Anahtarlar
+     * @return Silinen girdi sayısı
+     */
+    template <typename Keys>
+    size_t removeMany(const Keys& keys);
+
+    /**
+     * @brief Önbelleğe paylaşımlı, değiştirilemez veri ekler
+     * 
+     * Veri kopyalanmaz; önbellek yalnızca işaretçiyi tutar.
+     * 
+     * @param key Anahtar
+     * @param data Veri
+     * @param ttl Yaşam süresi (saniye)
+     * @param tags Etiketler (virgül, noktalı virgül veya boşlukla ayrılmış)
+     * @param size Değerin boyutu (bayt), 0 ise CacheSizeEstimator ile tahmin edilir
+     */
+    template <typename T>
+    void setShared(std::string_view key, std::shared_ptr<const T> data, std::chrono::seconds ttl = std::chrono::seconds(0), const std::string& tags = "", size_t size = 0);
+
+    /**
+     * @brief Önbellekten paylaşımlı veri alır
+     * 
+     * Bulunan veri kopyalanmaz; yalnızca referans sayacı artırılır. Ön önbellek
+     * etkinse değişmemiş anahtarlar parça kilidi alınmadan iş parçacığının
+     * kendi kopyasından döndürülür.
+     * 
+     * @param key Anahtar
+     * @return Veri, bulunamazsa nullptr
+     */
+    template <typename T>
+    std::shared_ptr<const T> getShared(std::string_view key);
+
+    /**
+     * @brief Önbellekten veri alır, yoksa yükleyiciyle hesaplayıp ekler
+     * 
+     * Aynı anahtar için eşzamanlı ıskalamalarda yükleyici yalnızca bir kez çağrılır;
+     * diğer çağıranlar aynı sonucu paylaşımlı bir future üzerinden bekler.
+     * Yükleyicinin fırlattığı istisna bekleyen tüm çağıranlara iletilir.
+     * Yükleyici aynı anahtar için getOrCompute çağırırsa kendi sonucunu bekleyerek
+     * kilitlenmek yerine std::logic_error fırlatılır.
+     * 
+     * @param key Anahtar
+     * @param loader Yükleyici (T döndüren çağrılabilir nesne)
+     * @param ttl Yaşam süresi (saniye)
+     * @param tags Etiketler
+     * @return Veri
+     * @throws std::logic_error Yükleyici aynı anahtarı özyinelemeli olarak isterse
+     */
+    template <typename T, typename Loader>
+    T getOrCompute(std::string_view key, Loader&& loader, std::chrono::seconds ttl = std::chrono::seconds(0), const std::string& tags = "");
+
+    /**
+     * @brief Anahtar için yenileme yükleyicisi kaydeder
+     * 
+     * Yükleyicinin değerleri yumuşak ve sert TTL ile önbelleğe eklenir. Yumuşak TTL
+     * dolduktan sonra okumalar bayat değeri hemen döndürür ve bakım zamanlayıcısının iş havuzunda
+     * eşzamansız bir yenileme planlanır. Sert TTL dolduğunda girdi silinir.
+     * İlk yükleme kayıttan hemen sonra arka planda yapılır.
+     * 
+     * @param key Anahtar
+     * @param loader Yükleyici (T döndüren çağrılabilir nesne)
+     * @param softTtl Yumuşak yaşam süresi (saniye)
+     * @param hardTtl Sert yaşam süresi (saniye), 0 ise varsayılan yaşam süresi
+     * @param tags Etiketler
+     */
+    template <typename T, typename Loader>
+    void registerLoader(std::string_view key, Loader loader, std::chrono::seconds softTtl, std::chrono::seconds hardTtl = std::chrono::seconds(0), const std::string& tags = "");
+
+    /**
+     * @brief Anahtarın yenileme yükleyicisini kaldırır
+     * 
+     * @param key Anahtar
+     * @return Yükleyici kaldırıldıysa true, değilse false
+     */
+    bool unregisterLoader(std::string_view key);
+
+    /**
+     * @brief Anahtar için eşzamansız yenileme planlar
+     * 
+     * Aynı anahtar için bekleyen bir yenileme varsa yeni yenileme planlanmaz.
+     * 
+     * @param key Anahtar
+     * @return Yenileme planlandıysa true, değilse false
+     */
+    bool refresh(std::string_view key);
 
     /**
      * @brief Önbellekten veri siler
@@ -68,7 +395,7 @@ public:
      * @param key Anahtar
      * @return Silme başarılıysa true, değilse false
      */
-    bool remove(const std::string& key);
+    bool remove(std::string_view key);
 
     /**
      * @brief Önbellekte anahtar varlığını kontrol eder
@@ -76,7 +403,7 @@ public:
      * @param key Anahtar
      * @return Anahtar varsa true, yoksa false
      */
-    bool has(const std::string& key);
+    bool has(std::string_view key);
 
     /**
      * @brief Önbelleği temizler
@@ -86,6 +413,9 @@ public:
     /**
      * @brief Süresi dolmuş girdileri temizler
      * 
+     * Yalnızca sona erme kuyruğunda zamanı gelmiş girdilere dokunulur. Her parçanın
+     * kilidi en fazla kExpirySliceSize girdi için tutulup bırakılır.
+     * 
      * @return Temizlenen girdi sayısı
      */
     size_t clearExpired();
@@ -93,11 +423,21 @@ public:
     /**
      * @brief Etiketlere göre girdileri temizler
      * 
+     * Verilen etiketlerin tümünü taşıyan girdiler, etiket dizini üzerinden bulunur.
+     * 
      * @param tags Etiketler
      * @return Temizlenen girdi sayısı
      */
     size_t clearByTags(const std::string& tags);
 
+    /**
+     * @brief Etiketi taşıyan anahtarları döndürür
+     * 
+     * @param tag Etiket
+     * @return Anahtarlar
+     */
+    std::vector<std::string> getKeysByTag(const std::string& tag) const;
+
     /**
      * @brief Önbellek boyutunu döndürür
      * 
@@ -119,6 +459,81 @@ public:
      */
     void setCapacity(size_t capacity);
 
+    /**
+     * @brief Bellek bütçesini döndürür
+     * 
+     * @return Bellek bütçesi (bayt), 0 ise sınırsız
+     */
+    size_t getMemoryBudget() const;
+
+    /**
+     * @brief Bellek bütçesini ayarlar
+     * 
+     * Girdilerin toplam boyutu bütçeyi aştığında tahliye politikasına göre girdi silinir.
+     * Bütçe, kapasite gibi parçalara eşit bölünür.
+     * 
+     * @param bytes Bellek bütçesi (bayt), 0 ise sınırsız
+     */
+    void setMemoryBudget(size_t bytes);
+
+    /**
+     * @brief Girdilerin toplam tahmini boyutunu döndürür
+     * 
+     * @return Bellek kullanımı (bayt)
+     */
+    size_t memoryUsage() const;
+
+    /**
+     * @brief Parça sayısını döndürür
+     * 
+     * @return Parça sayısı
+     */
+    size_t getShardCount() const;
+
+    /**
+     * @brief Parça sayısını ayarlar
+     * 
+     * Sayı, 2'nin bir sonraki kuvvetine yuvarlanır ve kMaxShardCount ile sınırlanır.
+     * Mevcut girdiler yeni parçalara dağıtılır.
+     * 
+     * @param count Parça sayısı
+     */
+    void setShardCount(size_t count);
+
+    /**
+     * @brief Tahliye politikasını döndürür
+     * 
+     * @return Tahliye politikası
+     */
+    EvictionPolicy getEvictionPolicy() const;
+
+    /**
+     * @brief Tahliye politikasını ayarlar
+     * 
+     * @param policy Tahliye politikası
+     */
+    void setEvictionPolicy(EvictionPolicy policy);
+
+    /**
+     * @brief Kabul politikasını döndürür
+     * 
+     * @return Kabul politikası
+     */
+    CacheAdmissionPolicy getAdmissionPolicy() const;
+
+    /**
+     * @brief Kabul politikasını ayarlar
+     * 
+     * TINY_LFU'da yeni girdiler önce kapasitenin yüzde biri kadar olan LRU
+     * penceresine girer. Pencereden taşan aday, ana bölgenin tahliye politikasının
+     * seçtiği kurbanla erişim sıklığına göre yarışır; sıklığı kurbanınkinden büyük
+     * değilse aday tahliye edilir. Böylece tek seferlik tarama anahtarları sık
+     * kullanılan girdileri önbellekten atamaz.
+     * 
+     * @param policy Kabul politikası
+     */
+    void setAdmissionPolicy(CacheAdmissionPolicy policy);
+
     /**
      * @brief Varsayılan yaşam süresini döndürür
      * 
@@ -169,142 +584,1086 @@ public:
     bool isAutoCleanupRunning() const;
 
     /**
-     * @brief Önbellek istatistiklerini döndürür
+     * @brief Anlık görüntüye yazılabilecek değer türünü kaydeder
      * 
-     * @return Önbellek istatistikleri
+     * Tür, nlohmann::json ile dönüştürülebilmelidir. Kaydedilmemiş türdeki
+     * girdiler anlık görüntüye yazılmaz.
+     * 
+     * @param name Dosyaya yazılan tür adı (süreçler arasında aynı kalmalıdır)
      */
-    std::unordered_map<std::string, size_t> getStats() const;
+    template <typename T>
+    void registerSnapshotType(const std::string& name = typeid(T).name());
 
     /**
-     * @brief Önbellek istatistiklerini sıfırlar
+     * @brief Önbelleği anlık görüntü dosyasına kaydeder
+     * 
+     * Girdiler değerleri, yaşam süreleri ve etiketleriyle, kullanım sırası
+     * korunarak yazılır. Parça kilitleri yalnızca kodlama sırasında tutulur.
+     * 
+     * @param filePath Dosya yolu, boşsa anlık görüntü yolu
+     * @return Kaydedilen girdi sayısı
      */
-    void resetStats();
+    size_t saveSnapshot(const std::string& filePath = "");
 
-private:
     /**
-     * @brief Yapıcı
+     * @brief Anlık görüntü dosyasını önbelleğe yükler
+     * 
+     * Süresi dolmuş ve türü kaydedilmemiş girdiler atlanır. Yükleme süresi ve
+     * yüklemeden sonra isabet oranının ısınma eşiğine ulaşma süresi
+     * istatistiklere eklenir.
+     * 
+     * @param filePath Dosya yolu, boşsa anlık görüntü yolu
+     * @return Yüklenen girdi sayısı
      */
-    DataCache();
+    size_t loadSnapshot(const std::string& filePath = "");
 
     /**
-     * @brief Kopyalama yapıcısı (engellendi)
+     * @brief Anlık görüntü yolunu döndürür
+     * 
+     * @return Anlık görüntü yolu
      */
-    DataCache(const DataCache&) = delete;
+    std::string getSnapshotPath() const;
 
     /**
-     * @brief Atama operatörü (engellendi)
+     * @brief Anlık görüntü yolunu ayarlar
+     * 
+     * Yol boş değilse önbellek kapanırken anlık görüntü bu yola kaydedilir.
+     * 
+     * @param filePath Anlık görüntü yolu
      */
-    DataCache& operator=(const DataCache&) = delete;
+    void setSnapshotPath(const std::string& filePath);
 
     /**
-     * @brief Otomatik temizleme işlemi
+     * @brief Periyodik anlık görüntü aralığını döndürür
+     * 
+     * @return Anlık görüntü aralığı
      */
-    void autoCleanup();
+    std::chrono::seconds getSnapshotInterval() const;
 
     /**
-     * @brief Önbellek kapasitesini kontrol eder
+     * @brief Periyodik anlık görüntü aralığını ayarlar
+     * 
+     * @param interval Anlık görüntü aralığı, 0 ise periyodik kayıt yapılmaz
      */
-    void checkCapacity();
+    void setSnapshotInterval(std::chrono::seconds interval);
 
-    std::unordered_map<std::string, CacheEntry> cache_; // Önbellek
-    mutable std::mutex cacheMutex_; // Önbellek mutex'i
-    size_t capacity_; // Önbellek kapasitesi
-    std::chrono::seconds defaultTtl_; // Varsayılan yaşam süresi
-    std::chrono::seconds cleanupInterval_; // Otomatik temizleme aralığı
-    bool autoCleanupRunning_; // Otomatik temizleme çalışıyor mu?
-    std::thread autoCleanupThread_; // Otomatik temizleme iş parçacığı
-    mutable std::mutex autoCleanupMutex_; // Otomatik temizleme mutex'i
-    std::unordered_map<std::string, size_t> stats_; // Önbellek istatistikleri
-    mutable std::mutex statsMutex_; // İstatistikler mutex'i
-};
+    /**
+     * @brief Disk taşma katmanını etkinleştirir
+     * 
+     * Kapasite veya bütçe nedeniyle tahliye edilen ve türü registerSnapshotType ile
+     * kaydedilmiş girdiler segment dosyasına yazılır. Bellekte bulunamayan anahtarlar
+     * önce bu dosyada aranır ve bulunursa belleğe geri alınır.
+     * 
+     * @param filePath Segment dosyası yolu
+     * @param byteBudget Disk katmanı bayt bütçesi, 0 ise sınırsız
+     * @return Segment dosyası açıldıysa true, değilse false
+     */
+    bool enableSpill(const std::string& filePath, size_t byteBudget);
 
-template <typename T>
-void DataCache::set(const std::string& key, const T& data, std::chrono::seconds ttl, const std::string& tags) {
-    std::lock_guard<std::mutex> lock(cacheMutex_);
-    
-    // Yaşam süresini ayarla
-    if (ttl.count() == 0) {
-        ttl = defaultTtl_;
-    }
-    
-    // Önbellek girdisi oluştur
-    CacheEntry entry;
-    entry.data = data;
-    entry.createdAt = std::chrono::system_clock::now();
-    entry.ttl = ttl;
-    
-    // Sona erme zamanını ayarla
-    if (ttl.count() > 0) {
-        entry.expiresAt = entry.createdAt + ttl;
-    } else {
-        entry.expiresAt = std::chrono::system_clock::time_point::max();
-    }
-    
-    entry.tags = tags;
-    
-    // Önbelleğe ekle
-    cache_[key] = entry;
-    
-    // Önbellek kapasitesini kontrol et
-    checkCapacity();
-    
-    // İstatistikleri güncelle
-    {
-        std::lock_guard<std::mutex> statsLock(statsMutex_);
-        stats_["set"]++;
-    }
-}
+    /**
+     * @brief Disk taşma katmanını kapatır ve segment dosyasını siler
+     */
+    void disableSpill();
 
-template <typename T>
-T DataCache::get(const std::string& key, const T& defaultValue) {
-    std::lock_guard<std::mutex> lock(cacheMutex_);
-    
-    // Anahtarı kontrol et
-    auto it = cache_.find(key);
-    if (it == cache_.end()) {
-        // İstatistikleri güncelle
-        {
-            std::lock_guard<std::mutex> statsLock(statsMutex_);
-            stats_["miss"]++;
-        }
-        
-        return defaultValue;
-    }
-    
-    // Sona erme zamanını kontrol et
-    if (it->second.expiresAt != std::chrono::system_clock::time_point::max() && it->second.expiresAt <= std::chrono::system_clock::now()) {
-        // Süresi dolmuş girdiyi sil
-        cache_.erase(it);
-        
-        // İstatistikleri güncelle
-        {
-            std::lock_guard<std::mutex> statsLock(statsMutex_);
-            stats_["expired"]++;
-            stats_["miss"]++;
-        }
-        
-        return defaultValue;
-    }
-    
-    // Veriyi döndür
-    try {
-        // İstatistikleri güncelle
-        {
-            std::lock_guard<std::mutex> statsLock(statsMutex_);
-            stats_["hit"]++;
-        }
-        
-        return std::any_cast<T>(it->second.data);
-    } catch (const std::bad_any_cast& e) {
-        // İstatistikleri güncelle
-        {
-            std::lock_guard<std::mutex> statsLock(statsMutex_);
-            stats_["error"]++;
-            stats_["miss"]++;
-        }
-        
-        return defaultValue;
-    }
+    /**
+     * @brief Disk taşma katmanının etkin olup olmadığını kontrol eder
+     * 
+     * @return Etkinse true, değilse false
+     */
+    bool isSpillEnabled() const;
+
+    /**
+     * @brief Süreçler arası paylaşımlı segmenti etkinleştirir
+     * 
+     * Yazılan ve türü registerSnapshotType ile kaydedilmiş girdiler segmente de
+     * yazılır; aynı adla segmenti açan başka bir süreç bu girdileri okuyabilir.
+     * Bellekte ve disk taşma katmanında bulunamayan anahtarlar segmentte aranır ve
+     * bulunursa belleğe alınır. Silmeler, clear() ve clearByTags() segmente
+     * yansıtılır; tahliye ve sona erme yalnızca yerel kopyayı etkiler. Segment
+     * kapatılınca silinmez.
+     * 
+     * @param name Segment adı
+     * @param slotCount Yuva sayısı (segment zaten varsa yok sayılır)
+     * @param slotSize Yuva başına en büyük kayıt boyutu (segment zaten varsa yok sayılır)
+     * @return Segment açıldıysa true, değilse false
+     */
+    bool enableSharedSegment(const std::string& name, size_t slotCount = CacheSharedSegment::kDefaultSlotCount,
+                             size_t slotSize = CacheSharedSegment::kDefaultSlotSize);
+
+    /**
+     * @brief Paylaşımlı segmenti kapatır
+     */
+    void disableSharedSegment();
+
+    /**
+     * @brief Paylaşımlı segmentin etkin olup olmadığını kontrol eder
+     * 
+     * @return Etkinse true, değilse false
+     */
+    bool isSharedSegmentEnabled() const;
+
+    /**
+     * @brief Çıkarılma dinleyicisi ekler
+     * 
+     * Dinleyici; tahliye edilen, süresi dolan, silinen, üzerine yazılan veya
+     * temizlenen her girdi için anahtarı, değeri ve nedeni alır. Dinleyiciler
+     * önbellek kilitleri dışında, ayrı bir iş parçacığında çağrılır ve önbelleği
+     * kullanabilir. Olay kuyruğu doluysa olaylar düşürülür.
+     * 
+     * @param listener Dinleyici
+     * @return Dinleyici kimliği
+     */
+    size_t addRemovalListener(CacheRemovalListener listener);
+
+    /**
+     * @brief Çıkarılma dinleyicisini kaldırır
+     * 
+     * @param id Dinleyici kimliği
+     * @return Dinleyici bulunduysa true, değilse false
+     */
+    bool removeRemovalListener(size_t id);
+
+    /**
+     * @brief Kuyruktaki tüm çıkarılma olayları iletilene kadar bekler
+     */
+    void flushRemovalListeners();
+
+    /**
+     * @brief Çıkarılma olay kuyruğunun kapasitesini döndürür
+     * 
+     * @return Kuyruk kapasitesi
+     */
+    size_t getListenerQueueCapacity() const;
+
+    /**
+     * @brief Çıkarılma olay kuyruğunun kapasitesini ayarlar
+     * 
+     * @param capacity Kuyruk kapasitesi
+     */
+    void setListenerQueueCapacity(size_t capacity);
+
+    /**
+     * @brief İş parçacığı yerel ön önbelleği etkinleştirir veya devre dışı bırakır
+     * 
+     * Ön önbellek, getShared() ile okunan değerlerin işaretçilerini her iş
+     * parçacığında kFrontCacheSlots yuvalık doğrudan eşlemeli bir tabloda tutar.
+     * Önbellekteki her yazma, silme, tahliye veya temizleme sürüm sayacını artırır
+     * ve tüm kopyaları geçersiz kılar; bu nedenle yalnızca çok okunan, seyrek
+     * değişen anahtarlar için uygundur. Ön önbellekten okunan girdiler tahliye
+     * sırasında öne alınmaz. Yumuşak TTL'li girdiler ön önbelleğe alınmaz.
+     * Yuvalar, üzerine yazılana kadar değerlere referans tutar.
+     * 
+     * @param enabled Etkinse true
+     */
+    void setFrontCacheEnabled(bool enabled);
+
+    /**
+     * @brief Ön önbelleğin etkin olup olmadığını kontrol eder
+     * 
+     * @return Etkinse true, değilse false
+     */
+    bool isFrontCacheEnabled() const;
+
+    /**
+     * @brief Sıkıştırma eşiğini döndürür
+     * 
+     * @return Eşik (bayt), 0 ise sıkıştırma yok
+     */
+    size_t getCompressionThreshold() const;
+
+    /**
+     * @brief Sıkıştırma eşiğini ayarlar
+     * 
+     * Tahmini boyutu eşiğe ulaşan değerler, registerSnapshotType() ile kaydedilmiş
+     * kodlayıcıyla kodlanır ve kilit dışında sıkıştırılır; okunurken parça kilidi
+     * altında açılır. Kodlayıcısı olmayan türler ve en az sekizde bir küçülmeyen
+     * değerler sıkıştırılmadan saklanır. Kapasite ve bellek bütçesi sıkıştırılmış
+     * boyutla hesaplanır. Eşik yalnızca sonraki yazmaları etkiler.
+     * 
+     * @param bytes Eşik (bayt), 0 ise sıkıştırma yok
+     */
+    void setCompressionThreshold(size_t bytes);
+
+    /**
+     * @brief Önbellek istatistiklerini döndürür
+     * 
+     * @return Önbellek istatistikleri
+     */
+    std::unordered_map<std::string, size_t> getStats() const;
+
+    /**
+     * @brief Önbellek istatistiklerini sıfırlar
+     */
+    void resetStats();
+
+    static constexpr size_t kDefaultShardCount = 1; // Varsayılan parça sayısı
+    static constexpr size_t kMaxShardCount = 256;   // En fazla parça sayısı
+    static constexpr size_t kExpirySliceSize = 256; // Kilit başına temizlenen en fazla girdi
+    static constexpr size_t kWarmupHitRatio = 80;   // Isınmış sayılan isabet oranı (yüzde)
+    static constexpr size_t kWarmupMinLookups = 100; // Isınma ölçümü için en az okuma sayısı
+    static constexpr size_t kDefaultListenerQueueCapacity = 4096; // Varsayılan çıkarılma olay kuyruğu kapasitesi
+    static constexpr size_t kFrontCacheSlots = 64; // İş parçacığı başına ön önbellek yuvası (2'nin kuvveti)
+    static constexpr size_t kMaxFreeNodes = 64; // Parça başına saklanan en fazla boş düğüm
+
+private:
+    friend class CacheRegistry;
+
+    /**
+     * @brief Yapıcı
+     * 
+     * @param config Yapılandırma
+     */
+    explicit DataCache(const CacheConfig& config = CacheConfig());
+
+    /**
+     * @brief Kopyalama yapıcısı (engellendi)
+     */
+    DataCache(const DataCache&) = delete;
+
+    /**
+     * @brief Atama operatörü (engellendi)
+     */
+    DataCache& operator=(const DataCache&) = delete;
+
+    /**
+     * @brief Otomatik temizleme işlemi
+     */
+    void autoCleanup();
+
+    /**
+     * @brief Önbelleğe yumuşak TTL ile veri ekler
+     * 
+     * @param key Anahtar
+     * @param data Veri
+     * @param ttl Sert yaşam süresi (saniye)
+     * @param softTtl Yumuşak yaşam süresi (saniye), 0 ise bayatlama yok
+     * @param tags Etiketler
+     * @param size Değerin boyutu (bayt)
+     */
+    template <typename T>
+    void store(std::string_view key, const T& data, std::chrono::seconds ttl, std::chrono::seconds softTtl, const std::string& tags, size_t size);
+
+    /**
+     * @brief Girdiyi ekler veya günceller
+     * 
+     * @param key Anahtar
+     * @param data Veri
+     * @param ttl Yaşam süresi
+     * @param expiresAt Sona erme zamanı
+     * @param staleAt Bayatlama zamanı
+     * @param tags Ayrıştırılmış etiketler
+     * @param size Girdinin boyutu (bayt)
+     */
+    void insertEntry(std::string_view key, std::any data, std::chrono::seconds ttl,
+                     CoarseClock::time_point expiresAt, CoarseClock::time_point staleAt,
+                     std::vector<std::string> tags, size_t size);
+
+    /**
+     * @brief Kilitli parçaya girdiyi ekler veya günceller
+     * 
+     * @param shard Kilitli parça
+     * @param key Anahtar
+     * @param data Veri
+     * @param ttl Yaşam süresi
+     * @param expiresAt Sona erme zamanı
+     * @param staleAt Bayatlama zamanı
+     * @param tags Ayrıştırılmış etiketler
+     * @param size Girdinin boyutu (bayt)
+     */
+    void insertLocked(CacheShard& shard, std::string_view key, std::any data, std::chrono::seconds ttl,
+                      CoarseClock::time_point expiresAt, CoarseClock::time_point staleAt,
+                      std::vector<std::string> tags, size_t size);
+
+    /**
+     * @brief Anlık görüntü kodlayıcısını kaydeder
+     * 
+     * @param type Değer türü
+     * @param codec Kodlayıcı
+     */
+    void addSnapshotCodec(std::type_index type, std::shared_ptr<const CacheSnapshotCodec> codec);
+
+    /**
+     * @brief Anlık görüntü yüklemesinden sonra isabet oranını kontrol eder
+     * 
+     * Oran ısınma eşiğine ilk ulaştığında geçen süreyi kaydeder.
+     */
+    void checkWarmup();
+
+    /**
+     * @brief Yenileme yükleyicisini kaydeder ve ilk yüklemeyi planlar
+     * 
+     * @param key Anahtar
+     * @param loader Değeri yükleyip önbelleğe ekleyen işlev
+     */
+    void addLoader(std::string_view key, std::function<void()> loader);
+
+    /**
+     * @brief Bakım zamanlayıcısının iş havuzuna yenileme görevi ekler
+     * 
+     * @param key Anahtar
+     * @return Görev eklendiyse true, yükleyici yoksa veya görev zaten bekliyorsa false
+     */
+    bool scheduleRefresh(std::string_view key);
+
+    /**
+     * @brief Anahtarın yükleyicisini çalıştırır
+     * 
+     * @param key Anahtar
+     */
+    void runRefresh(const std::string& key);
+
+    /**
+     * @brief Bakım zamanlayıcısındaki anlık görüntü ve yenileme görevlerini iptal eder
+     * 
+     * Çalışmakta olan görevlerin bitmesi beklenir.
+     */
+    void cancelMaintenance();
+
+    /**
+     * @brief Anahtarın parçasını kilitler ve döndürür
+     * 
+     * Kilit alındıktan sonra parça sayısı değişmişse işlem yeni parça sayısıyla tekrarlanır.
+     * 
+     * @param key Anahtar
+     * @param lock Parça kilidi
+     * @return Anahtarın parçası
+     */
+    CacheShard& lockShard(std::string_view key, std::unique_lock<std::mutex>& lock) const;
+
+    /**
+     * @brief Anahtarları parçalarına göre gruplar ve her grubu parça kilidi altında işler
+     * 
+     * Gruplar içinde anahtarların verilen sırası korunur. Kilitler sırasında parça
+     * sayısı değişirse kalan anahtarlar yeni parça sayısıyla yeniden gruplanır.
+     * 
+     * @param hashes Anahtarların karma değerleri
+     * @param callback Grup işleyicisi: callback(shard, indices, count)
+     */
+    template <typename Callback>
+    void forEachShardGroup(const std::vector<size_t>& hashes, Callback&& callback);
+
+    /**
+     * @brief Anahtarı kilitli parçadan ve disk taşma katmanından siler
+     * 
+     * @param shard Kilitli parça
+     * @param key Anahtar
+     * @return Bellekteki girdi silindiyse true, değilse false
+     */
+    bool removeLocked(CacheShard& shard, std::string_view key);
+
+    /**
+     * @brief Parça başına kapasiteyi döndürür
+     * 
+     * @return Parça başına kapasite
+     */
+    size_t shardCapacity() const;
+
+    /**
+     * @brief Parça kapasitesini kontrol eder
+     * 
+     * @param shard Kilitli parça
+     */
+    void checkCapacity(CacheShard& shard);
+
+    /**
+     * @brief Eski kayıtlar canlı girdileri fazlasıyla aşmışsa sona erme kuyruğunu sıkıştırır
+     * 
+     * @param shard Kilitli parça
+     */
+    void compactExpiry(CacheShard& shard);
+
+    /**
+     * @brief Değer eşiği aşıyorsa yerinde sıkıştırır
+     * 
+     * @param data Değer, sıkıştırılırsa CompressedCacheValue ile değiştirilir
+     * @param size Girdinin tahmini boyutu (değer + anahtar)
+     * @param keySize Anahtarın boyutu
+     * @return Girdinin önbellekte sayılacak boyutu
+     */
+    size_t compressValue(std::any& data, size_t size, size_t keySize);
+
+    /**
+     * @brief Sıkıştırılmış girdinin değerini açar
+     * 
+     * @param entry Kilitli parçadaki girdi
+     * @param type İstenen değer türü
+     * @return Değer, tür uyuşmazsa veya açılamazsa boş
+     */
+    std::any decompressValue(const CacheEntry& entry, const std::type_info& type);
+
+    /**
+     * @brief Girdiyi anlık görüntü kaydına kodlar
+     * 
+     * @param entry Kilitli parçadaki girdi
+     * @param tags Kaydın gösterdiği etiket tamponu
+     * @param payload Kaydın gösterdiği değer tamponu
+     * @param record Kayıt
+     * @return Türün kodlayıcısı varsa ve kodlama başarılıysa true, değilse false
+     */
+    bool encodeEntry(const CacheEntry& entry, std::string& tags, std::string& payload, CacheSnapshotRecord& record);
+
+    /**
+     * @brief Tahliye edilen girdiye disk taşma katmanında yer ayırır
+     * 
+     * Kayıt kilit altında kodlanır ve shard.pendingSpills listesine eklenir;
+     * diske yazma, parça kilidi bırakıldıktan sonra writeSpills ile yapılır.
+     * 
+     * @param shard Kilitli parça
+     * @param entry Kilitli parçadaki girdi
+     */
+    void spillEntry(CacheShard& shard, const CacheEntry& entry);
+
+    /**
+     * @brief Bekleyen taşma kayıtlarını diske yazar
+     * 
+     * Parça kilidi tutulmadan çağrılmalıdır.
+     * 
+     * @param spills Kayıtlar (boşaltılır)
+     */
+    void writeSpills(std::vector<PendingSpill>& spills);
+
+    /**
+     * @brief Okumanın ertelenen işlerini parça kilidi dışında yapar
+     * 
+     * @param key Anahtar
+     * @param deferred Ertelenen işler
+     */
+    void finishDeferred(std::string_view key, CacheDeferredWork& deferred);
+
+    /**
+     * @brief Disk taşma katmanındaki girdiyi belleğe geri alır
+     * 
+     * @param shard Kilitli parça
+     * @param key Anahtar
+     * @return Girdi, bulunamazsa shard.entries.end()
+     */
+    CacheEntryMap::iterator promoteSpilled(CacheShard& shard, std::string_view key);
+
+    /**
+     * @brief Yazılan girdiyi paylaşımlı segmente yazılmak üzere kuyruğa alır
+     * 
+     * Kayıt kilit altında kodlanır ve shard.pendingPublishes listesine eklenir;
+     * segmente yazma, parça kilidi bırakıldıktan sonra flushShared ile yapılır.
+     * 
+     * @param shard Kilitli parça
+     * @param key Anahtar
+     */
+    void publishShared(CacheShard& shard, std::string_view key);
+
+    /**
+     * @brief Parçanın kuyruktaki kayıtlarını paylaşımlı segmente yazar
+     * 
+     * Parça kilidi tutulmadan çağrılmalıdır. Aynı parçanın kayıtları publishMutex
+     * altında kuyruk sırasıyla yazılır; böylece eski değer yenisinin üzerine yazılmaz.
+     * 
+     * @param shard Parça
+     */
+    void flushShared(CacheShard& shard);
+
+    /**
+     * @brief Paylaşımlı segmentteki girdiyi belleğe alır
+     * 
+     * @param shard Kilitli parça
+     * @param key Anahtar
+     * @return Girdi, bulunamazsa shard.entries.end()
+     */
+    CacheEntryMap::iterator promoteShared(CacheShard& shard, std::string_view key);
+
+    /**
+     * @brief Kodlanmış kaydı çözer ve belleğe ekler
+     * 
+     * @param shard Kilitli parça
+     * @param key Anahtar
+     * @param record Kayıt
+     * @return Girdi, çözülemezse veya eklenmezse shard.entries.end()
+     */
+    CacheEntryMap::iterator insertRecord(CacheShard& shard, std::string_view key, const CacheSnapshotRecord& record);
+
+    /**
+     * @brief Kilitli parçada girdinin değerini arar
+     * 
+     * Süresi dolmuş girdiyi siler, kullanımı bildirir ve istatistikleri günceller.
+     * Bayat girdinin yenilemesini ve yükseltmenin tahliye ettiği girdilerin diske
+     * yazılmasını çağıran, parça kilidini bıraktıktan sonra yapar.
+     * 
+     * @param shard Kilitli parça
+     * @param key Anahtar
+     * @param decoded Sıkıştırılmış değer için açma deposu
+     * @param deferred Kilit dışında yapılacak işler
+     * @return Değer, bulunamazsa veya türü uyuşmazsa nullptr
+     */
+    template <typename T>
+    const T* findValue(CacheShard& shard, std::string_view key, std::optional<T>& decoded, CacheDeferredWork& deferred);
+
+    /**
+     * @brief Süren yükleme kaydını siler
+     * 
+     * @param key Anahtar
+     */
+    void finishLoad(std::string_view key);
+
+    /**
+     * @brief Dinleyici varsa girdinin değerini çıkarılma olayı olarak kuyruğa ekler
+     * 
+     * Değer olaya taşınır; girdi bundan sonra silinmeli veya yeni değer almalıdır.
+     * 
+     * @param entry Kilitli parçadaki girdi
+     * @param reason Neden
+     */
+    void notifyRemoval(CacheEntry& entry, CacheRemovalReason reason);
+
+    /**
+     * @brief Girdiyi parçadan siler
+     * 
+     * Düğüm (harita düğümü, girdi ve anahtar arabelleği) serbest bırakılmaz;
+     * parçanın boş düğüm listesi dolana kadar yeni girdiler için saklanır.
+     * 
+     * @param shard Kilitli parça
+     * @param it Girdi
+     * @param reason Çıkarılma nedeni
+     * @return Sonraki girdi
+     */
+    CacheEntryMap::iterator eraseEntry(CacheShard& shard, CacheEntryMap::iterator it, CacheRemovalReason reason);
+
+    /**
+     * @brief Ön önbellek etkinse tüm kopyaları geçersiz kılar
+     * 
+     * Okuyucular sürümü parça kilidini almadan önce okuduğu için değişiklikten
+     * sonra, parça kilidi tutulurken çağrılmalıdır.
+     */
+    void invalidateFrontCache() {
+        if (frontCacheEnabled_.load()) {
+            frontEpoch_.fetch_add(1);
+        }
+    }
+
+    /**
+     * @brief İş parçacığının ön önbelleğinde geçerli kopyayı arar
+     * 
+     * @param key Anahtar
+     * @param hash Anahtarın karma değeri
+     * @param type Değer türü
+     * @return Yuvadaki değer, bulunamazsa nullptr
+     */
+    const std::shared_ptr<const void>* frontGet(std::string_view key, size_t hash, const std::type_info& type);
+
+    /**
+     * @brief Değeri iş parçacığının ön önbelleğine ekler
+     * 
+     * @param key Anahtar
+     * @param hash Anahtarın karma değeri
+     * @param type Değer türü
+     * @param value Değer
+     * @param expiresAt Girdinin sona erme zamanı
+     * @param epoch Ana önbellek okunmadan önceki sürüm
+     */
+    void frontPut(std::string_view key, size_t hash, const std::type_info& type, std::shared_ptr<const void> value,
+                  CoarseClock::time_point expiresAt, uint64_t epoch);
+
+    std::unique_ptr<CacheShard[]> shards_; // Önbellek parçaları
+    std::atomic<size_t> shardCount_; // Etkin parça sayısı
+    std::atomic<size_t> capacity_; // Önbellek kapasitesi
+    std::atomic<size_t> memoryBudget_; // Bellek bütçesi (bayt)
+    std::atomic<EvictionPolicy> evictionPolicy_; // Tahliye politikası
+    std::atomic<CacheAdmissionPolicy> admissionPolicy_; // Kabul politikası
+    std::chrono::seconds defaultTtl_; // Varsayılan yaşam süresi
+    std::chrono::seconds cleanupInterval_; // Otomatik temizleme aralığı
+    std::atomic<bool> autoCleanupRunning_; // Otomatik temizleme çalışıyor mu?
+    MaintenanceScheduler& scheduler_; // Bakım zamanlayıcısı
+    MaintenanceScheduler::TaskId cleanupTask_; // Otomatik temizleme görevi, yoksa 0
+    MaintenanceScheduler::TaskId snapshotTask_; // Periyodik anlık görüntü görevi, yoksa 0
+    std::unordered_map<std::string, MaintenanceScheduler::TaskId> refreshTasks_; // Bekleyen veya süren yenileme görevleri
+    mutable std::mutex maintenanceMutex_; // Bakım görevleri mutex'i
+    std::unordered_map<std::string_view, std::unique_ptr<CacheRefreshLoader>> loaders_; // Yenileme yükleyicileri
+    mutable std::mutex loadersMutex_; // Yükleyici mutex'i
+    std::string snapshotPath_; // Anlık görüntü yolu (bakım kilidiyle korunur)
+    std::chrono::seconds snapshotInterval_; // Periyodik anlık görüntü aralığı
+    std::unordered_map<std::type_index, std::shared_ptr<const CacheSnapshotCodec>> snapshotCodecs_; // Türe göre kodlayıcılar
+    std::unordered_map<std::string, std::shared_ptr<const CacheSnapshotCodec>> snapshotCodecsByName_; // Ada göre kodlayıcılar
+    mutable std::mutex snapshotMutex_; // Kodlayıcı mutex'i
+    std::atomic<bool> warmupPending_; // Isınma ölçülüyor mu?
+    std::chrono::steady_clock::time_point warmupStart_; // Anlık görüntü yükleme zamanı
+    size_t warmupBaseHits_; // Yükleme anındaki isabet sayısı
+    size_t warmupBaseMisses_; // Yükleme anındaki ıskalama sayısı
+    std::atomic<size_t> warmupMillis_; // Isınma süresi (milisaniye)
+    std::atomic<size_t> snapshotLoadMicros_; // Son anlık görüntü yükleme süresi (mikrosaniye)
+    std::shared_ptr<CacheSpillStore> spill_; // Disk taşma katmanı (std::atomic_load ile okunur)
+    std::atomic<bool> spillEnabled_; // Disk taşma katmanı etkin mi?
+    std::shared_ptr<CacheSharedSegment> shared_; // Paylaşımlı segment (std::atomic_load ile okunur)
+    std::atomic<bool> sharedEnabled_; // Paylaşımlı segment etkin mi?
+    CacheEventDispatcher removalDispatcher_; // Çıkarılma olaylarının iletimi
+    const uint64_t instanceId_; // Ön önbellek yuvalarını ayıran örnek kimliği
+    std::atomic<bool> frontCacheEnabled_; // Ön önbellek etkin mi?
+    std::atomic<size_t> compressionThreshold_; // Sıkıştırma eşiği (bayt), 0 ise sıkıştırma yok
+    alignas(64) std::atomic<uint64_t> frontEpoch_; // Ön önbellek sürümü (her değişiklikte artar)
+    CacheStatCounters stats_; // Önbellek istatistikleri
+};
+
+template <typename T>
+void DataCache::set(std::string_view key, const T& data, std::chrono::seconds ttl, const std::string& tags, size_t size) {
+    store(key, data, ttl, std::chrono::seconds(0), tags, size);
+}
+
+template <typename T>
+void DataCache::store(std::string_view key, const T& data, std::chrono::seconds ttl, std::chrono::seconds softTtl, const std::string& tags, size_t size) {
+    // Etiketleri ve boyutu kilit dışında hesapla
+    std::vector<std::string> parsedTags = parseCacheTags(tags);
+    size_t entrySize = (size > 0 ? size : estimateCacheSize(data)) + key.size();
+    
+    // Yaşam süresini ayarla
+    if (ttl.count() == 0) {
+        ttl = defaultTtl_;
+    }
+    
+    // Sona erme ve bayatlama zamanlarını ayarla
+    auto now = CoarseClock::now();
+    auto expiresAt = ttl.count() > 0 ? now + ttl : CoarseClock::time_point::max();
+    auto staleAt = softTtl.count() > 0 && (ttl.count() == 0 || softTtl < ttl) ? now + softTtl : CoarseClock::time_point::max();
+    
+    // Büyük değeri kilit dışında sıkıştır
+    std::any value(data);
+    entrySize = compressValue(value, entrySize, key.size());
+    
+    insertEntry(key, std::move(value), ttl, expiresAt, staleAt, std::move(parsedTags), entrySize);
+}
+
+template <typename T>
+T DataCache::get(std::string_view key, const T& defaultValue) {
+    std::unique_lock<std::mutex> lock;
+    CacheShard& shard = lockShard(key, lock);
+    
+    // Veriyi döndür
+    std::optional<T> decoded;
+    CacheDeferredWork deferred;
+    const T* value = findValue<T>(shard, key, decoded, deferred);
+    
+    // Yenilemeyi ve taşma yazmalarını parça kilidi dışında yap
+    if (!deferred.empty()) {
+        std::optional<T> result;
+        if (value != nullptr) {
+            result = decoded ? std::move(*decoded) : *value;
+        }
+        lock.unlock();
+        finishDeferred(key, deferred);
+        return result ? std::move(*result) : defaultValue;
+    }
+    
+    if (value == nullptr) {
+        return defaultValue;
+    }
+    
+    return decoded ? std::move(*decoded) : *value;
+}
+
+template <typename T>
+bool DataCache::tryGet(std::string_view key, T& value) {
+    std::unique_lock<std::mutex> lock;
+    CacheShard& shard = lockShard(key, lock);
+    
+    // Veriyi kopyala
+    std::optional<T> decoded;
+    CacheDeferredWork deferred;
+    const T* found = findValue<T>(shard, key, decoded, deferred);
+    if (found != nullptr) {
+        value = decoded ? std::move(*decoded) : *found;
+    }
+    
+    // Yenilemeyi ve taşma yazmalarını parça kilidi dışında yap
+    if (!deferred.empty()) {
+        lock.unlock();
+        finishDeferred(key, deferred);
+    }
+    
+    return found != nullptr;
+}
+
+template <typename T, typename Keys>
+std::vector<std::optional<T>> DataCache::getMany(const Keys& keys) {
+    std::vector<std::optional<T>> values(std::size(keys));
+    std::vector<std::string_view> views(std::begin(keys), std::end(keys));
+    std::vector<size_t> hashes(views.size());
+    
+    // Karma değerlerini kilit dışında hesapla
+    std::hash<std::string_view> hasher;
+    for (size_t i = 0; i < views.size(); i++) {
+        hashes[i] = hasher(views[i]);
+    }
+    
+    std::vector<std::string_view> staleKeys;
+    CacheDeferredWork deferred;
+    forEachShardGroup(hashes, [&](CacheShard& shard, const size_t* indices, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            std::optional<T> decoded;
+            deferred.stale = false;
+            const T* value = findValue<T>(shard, views[indices[i]], decoded, deferred);
+            if (decoded) {
+                values[indices[i]] = std::move(decoded);
+            } else if (value != nullptr) {
+                values[indices[i]] = *value;
+            }
+            if (deferred.stale) {
+                staleKeys.push_back(views[indices[i]]);
+            }
+        }
+    });
+    
+    // Yenilemeleri ve taşma yazmalarını parça kilitleri dışında yap
+    for (std::string_view key : staleKeys) {
+        scheduleRefresh(key);
+    }
+    writeSpills(deferred.spills);
+    
+    return values;
+}
+
+template <typename Items>
+void DataCache::setMany(const Items& items, std::chrono::seconds ttl, const std::string& tags) {
+    // Etiketleri, değerleri, boyutları ve zamanları kilit dışında hazırla
+    std::vector<std::string> parsedTags = parseCacheTags(tags);
+    std::vector<std::pair<std::string_view, std::any>> entries;
+    std::vector<size_t> sizes;
+    std::vector<size_t> hashes;
+    std::hash<std::string_view> hasher;
+    
+    for (const auto& item : items) {
+        std::string_view key(item.first);
+        entries.emplace_back(key, std::any(item.second));
+        sizes.push_back(compressValue(entries.back().second, estimateCacheSize(item.second) + key.size(), key.size()));
+        hashes.push_back(hasher(key));
+    }
+    
+    if (ttl.count() == 0) {
+        ttl = defaultTtl_;
+    }
+    
+    auto now = CoarseClock::now();
+    auto expiresAt = ttl.count() > 0 ? now + ttl : CoarseClock::time_point::max();
+    
+    std::vector<PendingSpill> spills;
+    std::vector<CacheShard*> published;
+    bool shared = sharedEnabled_.load(std::memory_order_relaxed);
+    forEachShardGroup(hashes, [&](CacheShard& shard, const size_t* indices, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            auto& entry = entries[indices[i]];
+            insertLocked(shard, entry.first, std::move(entry.second), ttl, expiresAt, CoarseClock::time_point::max(), parsedTags, sizes[indices[i]]);
+            if (shared) {
+                publishShared(shard, entry.first);
+            }
+        }
+        shard.takePendingSpills(spills);
+        if (shared) {
+            published.push_back(&shard);
+        }
+    });
+    
+    // Tahliye edilen girdileri diske, toplu yazmayı paylaşımlı segmente parça kilitleri dışında yaz
+    writeSpills(spills);
+    for (CacheShard* shard : published) {
+        flushShared(*shard);
+    }
+    
+    // İstatistikleri güncelle
+    stats_.add(CacheStat::SET, entries.size());
+}
+
+template <typename Keys>
+size_t DataCache::removeMany(const Keys& keys) {
+    std::vector<std::string_view> views(std::begin(keys), std::end(keys));
+    std::vector<size_t> hashes(views.size());
+    size_t removed = 0;
+    
+    std::hash<std::string_view> hasher;
+    for (size_t i = 0; i < views.size(); i++) {
+        hashes[i] = hasher(views[i]);
+    }
+    
+    forEachShardGroup(hashes, [&](CacheShard& shard, const size_t* indices, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            if (removeLocked(shard, views[indices[i]])) {
+                removed++;
+            }
+        }
+    });
+    
+    // İstatistikleri güncelle
+    stats_.add(CacheStat::REMOVE, removed);
+    
+    return removed;
+}
+
+template <typename Callback>
+void DataCache::forEachShardGroup(const std::vector<size_t>& hashes, Callback&& callback) {
+    std::vector<size_t> pending(hashes.size());
+    std::iota(pending.begin(), pending.end(), 0);
+    
+    while (!pending.empty()) {
+        size_t shardCount = shardCount_.load(std::memory_order_acquire);
+        auto shardOf = [&](size_t index) {
+            return hashes[index] & (shardCount - 1);
+        };
+        
+        // Anahtarları parçalarına göre, verilen sırayı koruyarak sırala
+        std::stable_sort(pending.begin(), pending.end(), [&](size_t a, size_t b) {
+            return shardOf(a) < shardOf(b);
+        });
+        
+        std::vector<size_t> retry;
+        for (size_t begin = 0; begin < pending.size();) {
+            size_t shardIndex = shardOf(pending[begin]);
+            size_t end = begin + 1;
+            while (end < pending.size() && shardOf(pending[end]) == shardIndex) {
+                end++;
+            }
+            
+            std::lock_guard<std::mutex> lock(shards_[shardIndex].mutex);
+            
+            // Parça sayısı değiştiyse kalan anahtarları yeniden grupla
+            if (shardCount != shardCount_.load(std::memory_order_relaxed)) {
+                retry.assign(pending.begin() + begin, pending.end());
+                break;
+            }
+            
+            callback(shards_[shardIndex], pending.data() + begin, end - begin);
+            begin = end;
+        }
+        
+        pending.swap(retry);
+    }
+}
+
+template <typename T>
+const T* DataCache::findValue(CacheShard& shard, std::string_view key, std::optional<T>& decoded, CacheDeferredWork& deferred) {
+    // Kabul kararları için erişim sıklığını kaydet
+    if (admissionPolicy_.load(std::memory_order_relaxed) == CacheAdmissionPolicy::TINY_LFU) {
+        shard.sketch.increment(std::hash<std::string_view>()(key));
+    }
+    
+    // Anahtarı kontrol et, bellekte yoksa disk taşma katmanına ve paylaşımlı segmente bak
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end() && spillEnabled_.load(std::memory_order_relaxed)) {
+        it = promoteSpilled(shard, key);
+    }
+    if (it == shard.entries.end() && sharedEnabled_.load(std::memory_order_relaxed)) {
+        it = promoteShared(shard, key);
+    }
+    
+    // Yükseltmenin tahliye ettiği girdiler kilit dışında diske yazılır
+    shard.takePendingSpills(deferred.spills);
+    
+    if (it == shard.entries.end()) {
+        // İstatistikleri güncelle
+        stats_.add(CacheStat::MISS);
+        
+        return nullptr;
+    }
+    
+    CacheEntry& entry = *it->second;
+    bool stale = false;
+    
+    // Sona erme ve bayatlama zamanlarını kontrol et
+    if (entry.expiresAt != CoarseClock::time_point::max() || entry.staleAt != CoarseClock::time_point::max()) {
+        auto now = CoarseClock::now();
+        
+        if (entry.expiresAt <= now) {
+            // Süresi dolmuş girdiyi sil
+            eraseEntry(shard, it, CacheRemovalReason::EXPIRED);
+            
+            // İstatistikleri güncelle
+            stats_.add(CacheStat::EXPIRED);
+            stats_.add(CacheStat::MISS);
+            
+            return nullptr;
+        }
+        
+        stale = entry.staleAt <= now;
+    }
+    
+    // Kullanımı bildir
+    shard.listOf(entry).touch(&entry);
+    
+    const T* value = std::any_cast<T>(&entry.data);
+    
+    // Sıkıştırılmış değeri çağıranın deposuna aç
+    if (value == nullptr && entry.rawSize > 0) {
+        std::any decompressed = decompressValue(entry, typeid(T));
+        if (decompressed.has_value()) {
+            decoded = std::any_cast<T>(std::move(decompressed));
+            value = &*decoded;
+        }
+    }
+    
+    if (value == nullptr) {
+        // İstatistikleri güncelle
+        stats_.add(CacheStat::CAST_ERROR);
+        stats_.add(CacheStat::MISS);
+        
+        return nullptr;
+    }
+    
+    // Bayat değeri döndür, yenilemeyi çağıran kilit dışında planlar
+    if (stale) {
+        deferred.stale = true;
+        stats_.add(CacheStat::STALE_HIT);
+    }
+    
+    // İstatistikleri güncelle
+    stats_.add(CacheStat::HIT);
+    
+    if (warmupPending_.load(std::memory_order_acquire)) {
+        checkWarmup();
+    }
+    
+    return value;
+}
+
+template <typename T>
+void DataCache::setShared(std::string_view key, std::shared_ptr<const T> data, std::chrono::seconds ttl, const std::string& tags, size_t size) {
+    set<std::shared_ptr<const T>>(key, data, ttl, tags, size);
+}
+
+template <typename T>
+std::shared_ptr<const T> DataCache::getShared(std::string_view key) {
+    if (!frontCacheEnabled_.load(std::memory_order_relaxed)) {
+        return get<std::shared_ptr<const T>>(key, nullptr);
+    }
+    
+    // Geçerli yerel kopya varsa parça kilidi alınmaz
+    size_t hash = std::hash<std::string_view>()(key);
+    const std::shared_ptr<const void>* front = frontGet(key, hash, typeid(T));
+    if (front != nullptr) {
+        return std::shared_ptr<const T>(*front, static_cast<const T*>(front->get()));
+    }
+    
+    // Sürüm kilitten önce okunur; araya giren değişiklik kopyayı geçersiz kılar
+    uint64_t epoch = frontEpoch_.load();
+    std::shared_ptr<const T> value;
+    CoarseClock::time_point expiresAt;
+    CacheDeferredWork deferred;
+    bool found = false;
+    bool staling = false;
+    {
+        std::unique_lock<std::mutex> lock;
+        CacheShard& shard = lockShard(key, lock);
+        
+        std::optional<std::shared_ptr<const T>> decoded;
+        const std::shared_ptr<const T>* current = findValue<std::shared_ptr<const T>>(shard, key, decoded, deferred);
+        if (current != nullptr) {
+            found = true;
+            value = *current;
+            
+            // Bayatlayan girdiler her okumada yenileme için denetlensin diye yerel kopyaya alınmaz
+            const CacheEntry& entry = *shard.entries.find(key)->second;
+            staling = entry.staleAt != CoarseClock::time_point::max();
+            expiresAt = entry.expiresAt;
+        }
+    }
+    
+    // Yenilemeyi ve taşma yazmalarını parça kilidi dışında yap
+    if (!deferred.empty()) {
+        finishDeferred(key, deferred);
+    }
+    
+    if (found && value && !staling) {
+        frontPut(key, hash, typeid(T), value, expiresAt, epoch);
+    }
+    
+    return value;
+}
+
+template <typename T, typename Loader>
+T DataCache::getOrCompute(std::string_view key, Loader&& loader, std::chrono::seconds ttl, const std::string& tags) {
+    std::promise<std::any> promise;
+    std::shared_future<std::any> pending;
+    CacheDeferredWork deferred;
+    bool leader = false;
+    bool recursive = false;
+    
+    {
+        std::unique_lock<std::mutex> lock;
+        CacheShard& shard = lockShard(key, lock);
+        
+        // Önbellekte varsa döndür; yenilemeyi ve taşma yazmalarını kilit dışında yap
+        std::optional<T> decoded;
+        const T* value = findValue<T>(shard, key, decoded, deferred);
+        if (value != nullptr && !deferred.empty()) {
+            T result = decoded ? std::move(*decoded) : *value;
+            lock.unlock();
+            finishDeferred(key, deferred);
+            return result;
+        }
+        if (value != nullptr) {
+            return decoded ? std::move(*decoded) : *value;
+        }
+        
+        // Süren bir yükleme varsa ona katıl, yoksa yüklemeyi üstlen
+        std::string loadingKey(key);
+        auto it = shard.loading.find(loadingKey);
+        if (it != shard.loading.end()) {
+            // Yükleyici aynı anahtarı yeniden isterse kendi sonucunu bekleyerek kilitlenirdi
+            recursive = it->second.leader == std::this_thread::get_id();
+            pending = it->second.result;
+        } else {
+            pending = promise.get_future().share();
+            shard.loading.emplace(std::move(loadingKey), CacheLoad{pending, std::this_thread::get_id()});
+            leader = true;
+        }
+    }
+    
+    // Iskalamada yükseltmenin tahliye ettiği girdileri diske yaz
+    writeSpills(deferred.spills);
+    
+    if (recursive) {
+        throw std::logic_error("recursive getOrCompute for cache key " + std::string(key));
+    }
+    
+    if (!leader) {
+        // Yükleyenin sonucunu bekle
+        const std::any& result = pending.get();
+        const T* value = std::any_cast<T>(&result);
+        if (value != nullptr) {
+            // İstatistikleri güncelle
+            stats_.add(CacheStat::LOAD_SAVED);
+            
+            return *value;
+        }
+    }
+    
+    // İstatistikleri güncelle
+    stats_.add(CacheStat::LOAD);
+    
+    try {
+        T value = loader();
+        
+        // Önce önbelleğe ekle, sonra bekleyenleri uyandır
+        set(key, value, ttl, tags);
+        if (leader) {
+            finishLoad(key);
+            promise.set_value(std::any(value));
+        }
+        
+        return value;
+    } catch (...) {
+        if (leader) {
+            finishLoad(key);
+            promise.set_exception(std::current_exception());
+        }
+        throw;
+    }
+}
+
+template <typename T, typename Loader>
+void DataCache::registerLoader(std::string_view key, Loader loader, std::chrono::seconds softTtl, std::chrono::seconds hardTtl, const std::string& tags) {
+    std::string storedKey(key);
+    
+    addLoader(key, [this, storedKey, loader = std::move(loader), softTtl, hardTtl, tags]() mutable {
+        T value = loader();
+        store(storedKey, value, hardTtl, softTtl, tags, 0);
+    });
+}
+
+template <typename T>
+void DataCache::registerSnapshotType(const std::string& name) {
+    addSnapshotCodec(std::type_index(typeid(T)), makeCacheSnapshotCodec<T>(name));
 }
 
 } // namespace data
@@ -1,14 +1,24 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <vector>
+#include <optional>
 #include <unordered_map>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <atomic>
 #include <functional>
+#include <typeindex>
+#include <filesystem>
 #include <nlohmann/json.hpp>
 #include "data/data_serializer.h"
 #include "data/data_validator.h"
 #include "data/data_cache.h"
+#include "data/cache_registry.h"
+#include "data/typed_cache.h"
+#include "data/maintenance_scheduler.h"
 
 namespace alt_las {
 namespace data {
@@ -20,6 +30,10 @@ namespace data {
  */
 class DataManager {
 public:
+    static constexpr char kNamespaceSeparator = ':'; // Ad alanı ile anahtarı ayıran karakter
+    static constexpr std::chrono::seconds kDefaultMissingDataTtl{5}; // Eksik veri kaydının varsayılan yaşam süresi
+    static constexpr size_t kMissingDataCapacity = 10000; // Eksik veri önbelleği kapasitesi
+    
     /**
      * @brief Singleton örneğini döndürür
      * 
@@ -53,6 +67,42 @@ public:
      */
     DataCache& getCache();
 
+    /**
+     * @brief Anahtar ad alanı için ayrı bir önbellek örneği oluşturur
+     * 
+     * "ad:" önekiyle başlayan anahtarlar (ör. "screen:frame1") bu örneğe yönlendirilir;
+     * diğer anahtarlar varsayılan önbellekte kalır. Örnek CacheRegistry'de ad alanı
+     * adıyla kaydedilir ve otomatik temizlemesi başlatılır. Ad alanı zaten varsa
+     * mevcut örnek döndürülür.
+     * 
+     * @param name Ad alanı
+     * @param config Yapılandırma
+     * @return Önbellek
+     */
+    std::shared_ptr<DataCache> createCacheNamespace(const std::string& name, const CacheConfig& config = CacheConfig());
+
+    /**
+     * @brief Anahtarın yönlendirildiği önbelleği döndürür
+     * 
+     * @param key Anahtar
+     * @return Ad alanının önbelleği, ad alanı yoksa varsayılan önbellek
+     */
+    DataCache& getCacheFor(std::string_view key) const;
+
+    /**
+     * @brief Adlandırılmış tür güvenli önbelleği döndürür
+     * 
+     * Önbellek yoksa verilen ayarlarla oluşturulur ve otomatik temizlemesi başlatılır.
+     * Sık kullanılan anahtar alanları için std::any maliyetinden kaçınmak amacıyla kullanılır.
+     * 
+     * @param name Önbellek adı
+     * @param capacity Önbellek kapasitesi (yalnızca oluşturulurken kullanılır)
+     * @param shardCount Parça sayısı (yalnızca oluşturulurken kullanılır)
+     * @return Önbellek, aynı adla farklı türde bir önbellek varsa nullptr
+     */
+    template <typename V>
+    std::shared_ptr<TypedCache<std::string, V>> getTypedCache(const std::string& name, size_t capacity = 1000, size_t shardCount = 1);
+
     /**
      * @brief Veriyi kaydeder
      * 
@@ -62,7 +112,7 @@ public:
      * @return Kaydetme başarılıysa true, değilse false
      */
     template <typename T>
-    bool saveData(const std::string& key, const T& data, SerializationFormat format = SerializationFormat::JSON);
+    bool saveData(std::string_view key, const T& data, SerializationFormat format = SerializationFormat::JSON);
 
     /**
      * @brief Veriyi yükler
@@ -73,7 +123,33 @@ public:
      * @return Veri
      */
     template <typename T>
-    T loadData(const std::string& key, const T& defaultValue = T(), SerializationFormat format = SerializationFormat::JSON);
+    T loadData(std::string_view key, const T& defaultValue = T(), SerializationFormat format = SerializationFormat::JSON);
+
+    /**
+     * @brief Birden fazla veriyi kaydeder
+     * 
+     * Başarıyla kaydedilen veriler tek bir toplu işlemle önbelleğe eklenir.
+     * 
+     * @param items Anahtar-veri çiftleri (first: anahtar, second: veri)
+     * @param format Serileştirme formatı
+     * @return Kaydedilen veri sayısı
+     */
+    template <typename Items>
+    size_t saveMany(const Items& items, SerializationFormat format = SerializationFormat::JSON);
+
+    /**
+     * @brief Birden fazla veriyi yükler
+     * 
+     * Önbellek tek bir toplu işlemle sorgulanır; bulunamayan veriler dosyalardan
+     * yüklenir ve yine tek bir toplu işlemle önbelleğe eklenir.
+     * 
+     * @param keys Anahtarlar
+     * @param defaultValue Varsayılan değer
+     * @param format Serileştirme formatı
+     * @return Anahtarlarla aynı sırada veriler
+     */
+    template <typename T, typename Keys>
+    std::vector<T> loadMany(const Keys& keys, const T& defaultValue = T(), SerializationFormat format = SerializationFormat::JSON);
 
     /**
      * @brief Veriyi siler
@@ -81,7 +157,7 @@ public:
      * @param key Anahtar
      * @return Silme başarılıysa true, değilse false
      */
-    bool removeData(const std::string& key);
+    bool removeData(std::string_view key);
 
     /**
      * @brief Veri varlığını kontrol eder
@@ -89,7 +165,7 @@ public:
      * @param key Anahtar
      * @return Veri varsa true, yoksa false
      */
-    bool hasData(const std::string& key);
+    bool hasData(std::string_view key);
 
     /**
      * @brief Veriyi doğrular
@@ -110,7 +186,7 @@ public:
      * @param tags Etiketler
      */
     template <typename T>
-    void cacheData(const std::string& key, const T& data, std::chrono::seconds ttl = std::chrono::seconds(0), const std::string& tags = "");
+    void cacheData(std::string_view key, const T& data, std::chrono::seconds ttl = std::chrono::seconds(0), const std::string& tags = "");
 
     /**
      * @brief Önbellekten veri alır
@@ -120,7 +196,74 @@ public:
      * @return Veri
      */
     template <typename T>
-    T getCachedData(const std::string& key, const T& defaultValue = T());
+    T getCachedData(std::string_view key, const T& defaultValue = T());
+
+    /**
+     * @brief Önbellek anlık görüntüsüne yazılabilecek veri türünü kaydeder
+     * 
+     * Tür, varsayılan önbelleğe ve o ana kadar oluşturulmuş ad alanlarına kaydedilir.
+     * 
+     * @param name Dosyaya yazılan tür adı
+     */
+    template <typename T>
+    void registerCacheType(const std::string& name = typeid(T).name());
+
+    /**
+     * @brief Önbelleği veri dizinindeki anlık görüntü dosyasına kaydeder
+     * 
+     * @return Kaydedilen girdi sayısı
+     */
+    size_t saveCacheSnapshot();
+
+    /**
+     * @brief Veri dizinindeki anlık görüntü dosyasını önbelleğe yükler
+     * 
+     * Anlık görüntüdeki türler önceden registerCacheType ile kaydedilmelidir.
+     * 
+     * @return Yüklenen girdi sayısı
+     */
+    size_t loadCacheSnapshot();
+
+    /**
+     * @brief Önbellek için veri dizininde disk taşma katmanı açar
+     * 
+     * Önbellekten tahliye edilen girdiler, veri dosyalarına düşmeden önce bu
+     * katmandan okunur. Türler registerCacheType ile kaydedilmelidir.
+     * 
+     * @param byteBudget Disk katmanı bayt bütçesi, 0 ise sınırsız
+     * @return Katman açıldıysa true, değilse false
+     */
+    bool enableCacheSpill(size_t byteBudget);
+
+    /**
+     * @brief Önbellek için süreçler arası paylaşımlı segment açar
+     * 
+     * Aynı segment adını kullanan süreçler (ör. arayüz veya analiz süreci),
+     * çekirdeğin önbelleğe yazdığı girdileri yeniden yüklemeden okuyabilir.
+     * Türler registerCacheType ile kaydedilmelidir.
+     * 
+     * @param name Segment adı
+     * @return Segment açıldıysa true, değilse false
+     */
+    bool enableCacheSharedSegment(const std::string& name);
+
+    /**
+     * @brief Eksik veri kayıtlarının yaşam süresini döndürür
+     * 
+     * @return Yaşam süresi, 0 ise eksik veri önbelleği kapalı
+     */
+    std::chrono::seconds getMissingDataTtl() const;
+
+    /**
+     * @brief Eksik veri kayıtlarının yaşam süresini ayarlar
+     * 
+     * hasData, loadData ve loadMany dosyası bulunmayan anahtarı bu süre boyunca
+     * hatırlar ve dosya sistemine tekrar bakmaz. Kayıt saveData ve saveMany ile
+     * silinir; dosyalar veri yöneticisi dışında oluşturuluyorsa süre kısa tutulmalıdır.
+     * 
+     * @param ttl Yaşam süresi, 0 ise eksik veri önbelleği kapatılır
+     */
+    void setMissingDataTtl(std::chrono::seconds ttl);
 
     /**
      * @brief Veri dizinini döndürür
@@ -156,7 +299,14 @@ public:
      * @param key Anahtar
      * @return Veri yolu
      */
-    std::string createDataPath(const std::string& key) const;
+    std::string createDataPath(std::string_view key) const;
+
+    /**
+     * @brief Önbellek anlık görüntü yolunu oluşturur
+     * 
+     * @return Anlık görüntü yolu
+     */
+    std::string createCacheSnapshotPath() const;
 
     /**
      * @brief Veri yönetim raporunu oluşturur
@@ -178,6 +328,22 @@ public:
      */
     void printDataReport() const;
 
+    /**
+     * @brief Veri yönetim raporunu bakım zamanlayıcısında periyodik olarak dosyaya kaydeder
+     * 
+     * Çalışan periyodik kayıt varsa yeni yol ve aralıkla değiştirilir.
+     * 
+     * @param filePath Dosya yolu
+     * @param interval Kayıt aralığı
+     * @return Zamanlama başarılıysa true, aralık sıfırsa false
+     */
+    bool startReportFlush(const std::string& filePath, std::chrono::seconds interval);
+
+    /**
+     * @brief Periyodik rapor kaydını durdurur
+     */
+    void stopReportFlush();
+
 private:
     /**
      * @brief Yapıcı
@@ -201,24 +367,103 @@ private:
      */
     bool createDataDirectory() const;
 
+    /**
+     * @brief Anahtarları yönlendirildikleri önbelleklere göre gruplar
+     * 
+     * @param keys Anahtarlar
+     * @return Önbellekler ve her birine düşen anahtarların indeksleri
+     */
+    std::vector<std::pair<DataCache*, std::vector<size_t>>> groupByCache(const std::vector<std::string_view>& keys) const;
+
+    /**
+     * @brief Anahtarın dosyasının olmadığını kontrol eder
+     * 
+     * Önce eksik veri önbelleğine bakar; dosya sistemine bakıldıysa ve dosya yoksa
+     * anahtarı eksik olarak kaydeder.
+     * 
+     * @param key Anahtar
+     * @param filePath Veri yolu
+     * @return Dosya yoksa true, varsa false
+     */
+    bool isDataMissing(std::string_view key, const std::string& filePath);
+
+    /**
+     * @brief Kaydedilen anahtarın eksik veri kaydını siler
+     * 
+     * @param key Anahtar
+     */
+    void forgetMissingData(std::string_view key);
+
+    using CacheNamespaceMap = std::map<std::string, std::shared_ptr<DataCache>, std::less<>>;
+
+    /**
+     * @brief Tür güvenli önbellek kaydı
+     */
+    struct TypedCacheSlot {
+        std::type_index type;                                           // Değer türü
+        std::shared_ptr<void> cache;                                    // Önbellek
+        std::function<size_t()> size;                                   // Boyut sorgusu
+        std::function<std::unordered_map<std::string, size_t>()> stats; // İstatistik sorgusu
+    };
+
     DataSerializer& serializer_; // Veri serileştiricisi
     DataValidator& validator_; // Veri doğrulayıcısı
     DataCache& cache_; // Veri önbelleği
     std::string dataDirectory_; // Veri dizini
     std::string dataExtension_; // Veri uzantısı
     mutable std::mutex directoryMutex_; // Dizin mutex'i
+    std::unordered_map<std::string, TypedCacheSlot> typedCaches_; // Tür güvenli önbellekler
+    mutable std::mutex typedCachesMutex_; // Tür güvenli önbellekler mutex'i
+    std::shared_ptr<const CacheNamespaceMap> cacheNamespaces_; // Ad alanı önbellekleri (yazarken kopyalanır, std::atomic_load ile okunur)
+    std::atomic<bool> hasCacheNamespaces_; // Ad alanı var mı?
+    std::mutex cacheNamespacesMutex_; // Ad alanı yazma mutex'i
+    TypedCache<std::string, bool> missingData_; // Dosyası olmayan anahtarlar (negatif önbellek)
+    std::atomic<bool> missingDataEnabled_; // Eksik veri önbelleği etkin mi?
+    std::atomic<uint64_t> saveEpoch_; // Kaydetme sayacı (eksik veri kaydı ile kaydetme yarışını önler)
+    MaintenanceScheduler::TaskId reportTask_; // Periyodik rapor kaydı görevi, yoksa 0
+    std::mutex reportMutex_; // Rapor görevi mutex'i
 };
 
+template <typename V>
+std::shared_ptr<TypedCache<std::string, V>> DataManager::getTypedCache(const std::string& name, size_t capacity, size_t shardCount) {
+    std::lock_guard<std::mutex> lock(typedCachesMutex_);
+    
+    // Mevcut önbelleği kontrol et
+    auto it = typedCaches_.find(name);
+    if (it != typedCaches_.end()) {
+        if (it->second.type != std::type_index(typeid(V))) {
+            return nullptr;
+        }
+        
+        return std::static_pointer_cast<TypedCache<std::string, V>>(it->second.cache);
+    }
+    
+    // Yeni önbellek oluştur
+    auto cache = std::make_shared<TypedCache<std::string, V>>(capacity, cache_.getDefaultTtl(), shardCount);
+    cache->startAutoCleanup();
+    
+    TypedCacheSlot slot{
+        std::type_index(typeid(V)),
+        cache,
+        [cache]() { return cache->size(); },
+        [cache]() { return cache->getStats(); }
+    };
+    typedCaches_.emplace(name, std::move(slot));
+    
+    return cache;
+}
+
 template <typename T>
-bool DataManager::saveData(const std::string& key, const T& data, SerializationFormat format) {
+bool DataManager::saveData(std::string_view key, const T& data, SerializationFormat format) {
     // Veri yolunu oluştur
     std::string filePath = createDataPath(key);
     
     // Veriyi serileştir ve dosyaya kaydet
     bool success = serializer_.serializeToFile(data, filePath, format);
     
-    // Veriyi önbelleğe ekle
+    // Eksik veri kaydını sil ve veriyi önbelleğe ekle
     if (success) {
+        forgetMissingData(key);
         cacheData(key, data);
     }
     
@@ -226,17 +471,23 @@ bool DataManager::saveData(const std::string& key, const T& data, SerializationF
 }
 
 template <typename T>
-T DataManager::loadData(const std::string& key, const T& defaultValue, SerializationFormat format) {
-    // Önbellekten veri al
-    if (cache_.has(key)) {
-        return getCachedData(key, defaultValue);
+T DataManager::loadData(std::string_view key, const T& defaultValue, SerializationFormat format) {
+    // Önbellekten veri al (tek arama, geçici anahtar oluşturmadan)
+    T data;
+    if (getCacheFor(key).tryGet(key, data)) {
+        return data;
     }
     
     // Veri yolunu oluştur
     std::string filePath = createDataPath(key);
     
+    // Dosya yoksa varsayılan değeri döndür
+    if (isDataMissing(key, filePath)) {
+        return defaultValue;
+    }
+    
     // Veriyi dosyadan deserileştir
-    T data = serializer_.deserializeFromFile<T>(filePath, format);
+    data = serializer_.deserializeFromFile<T>(filePath, format);
     
     // Veriyi önbelleğe ekle
     cacheData(key, data);
@@ -244,6 +495,95 @@ T DataManager::loadData(const std::string& key, const T& defaultValue, Serializa
     return data;
 }
 
+template <typename Items>
+size_t DataManager::saveMany(const Items& items, SerializationFormat format) {
+    using Value = std::decay_t<decltype(std::begin(items)->second)>;
+    std::vector<std::string_view> keys;
+    std::vector<const Value*> values;
+    
+    // Verileri serileştir ve dosyalara kaydet
+    for (const auto& item : items) {
+        std::string_view key(item.first);
+        if (serializer_.serializeToFile(item.second, createDataPath(key), format)) {
+            forgetMissingData(key);
+            keys.push_back(key);
+            values.push_back(&item.second);
+        }
+    }
+    
+    // Kaydedilen verileri önbelleklerine toplu ekle
+    for (const auto& group : groupByCache(keys)) {
+        std::vector<std::pair<std::string_view, const Value&>> saved;
+        saved.reserve(group.second.size());
+        for (size_t index : group.second) {
+            saved.emplace_back(keys[index], *values[index]);
+        }
+        group.first->setMany(saved);
+    }
+    
+    return keys.size();
+}
+
+template <typename T, typename Keys>
+std::vector<T> DataManager::loadMany(const Keys& keys, const T& defaultValue, SerializationFormat format) {
+    std::vector<std::string_view> views(std::begin(keys), std::end(keys));
+    std::vector<std::optional<T>> cached(views.size());
+    std::vector<T> values;
+    std::vector<bool> loaded(views.size(), false);
+    bool anyLoaded = false;
+    
+    // Önbellekleri toplu sorgula
+    auto groups = groupByCache(views);
+    for (const auto& group : groups) {
+        std::vector<std::string_view> groupKeys;
+        groupKeys.reserve(group.second.size());
+        for (size_t index : group.second) {
+            groupKeys.push_back(views[index]);
+        }
+        
+        auto groupValues = group.first->getMany<T>(groupKeys);
+        for (size_t i = 0; i < groupValues.size(); i++) {
+            cached[group.second[i]] = std::move(groupValues[i]);
+        }
+    }
+    
+    values.reserve(views.size());
+    for (size_t i = 0; i < views.size(); i++) {
+        if (cached[i]) {
+            values.push_back(std::move(*cached[i]));
+            continue;
+        }
+        
+        // Dosya yoksa varsayılan değeri kullan
+        std::string filePath = createDataPath(views[i]);
+        if (isDataMissing(views[i], filePath)) {
+            values.push_back(defaultValue);
+            continue;
+        }
+        
+        // Veriyi dosyadan deserileştir
+        values.push_back(serializer_.deserializeFromFile<T>(filePath, format));
+        loaded[i] = true;
+        anyLoaded = true;
+    }
+    
+    // Dosyalardan yüklenen verileri önbelleklerine toplu ekle
+    for (size_t g = 0; anyLoaded && g < groups.size(); g++) {
+        std::vector<std::pair<std::string_view, const T&>> items;
+        for (size_t index : groups[g].second) {
+            if (loaded[index]) {
+                items.emplace_back(views[index], values[index]);
+            }
+        }
+        
+        if (!items.empty()) {
+            groups[g].first->setMany(items);
+        }
+    }
+    
+    return values;
+}
+
 template <typename T>
 ValidationResult DataManager::validateData(const T& data, const std::string& schemaName) {
     // Veriyi JSON formatına dönüştür
@@ -254,15 +594,24 @@ ValidationResult DataManager::validateData(const T& data, const std::string& sch
 }
 
 template <typename T>
-void DataManager::cacheData(const std::string& key, const T& data, std::chrono::seconds ttl, const std::string& tags) {
-    // Veriyi önbelleğe ekle
-    cache_.set(key, data, ttl, tags);
+void DataManager::cacheData(std::string_view key, const T& data, std::chrono::seconds ttl, const std::string& tags) {
+    // Veriyi anahtarın önbelleğine ekle
+    getCacheFor(key).set(key, data, ttl, tags);
+}
+
+template <typename T>
+void DataManager::registerCacheType(const std::string& name) {
+    cache_.registerSnapshotType<T>(name);
+    
+    for (const auto& pair : *std::atomic_load(&cacheNamespaces_)) {
+        pair.second->registerSnapshotType<T>(name);
+    }
 }
 
 template <typename T>
-T DataManager::getCachedData(const std::string& key, const T& defaultValue) {
-    // Önbellekten veri al
-    return cache_.get(key, defaultValue);
+T DataManager::getCachedData(std::string_view key, const T& defaultValue) {
+    // Anahtarın önbelleğinden veri al
+    return getCacheFor(key).get(key, defaultValue);
 }
 
 } // namespace data
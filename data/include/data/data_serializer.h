@@ -1,11 +1,13 @@
 #pragma once
 
 #include <string>
+#include <cstdint>
 #include <vector>
 #include <unordered_map>
 #include <memory>
 #include <mutex>
 #include <functional>
+#include <fstream>
 #include <nlohmann/json.hpp>
 
 namespace alt_las {
@@ -22,6 +24,9 @@ enum class SerializationFormat {
     CUSTOM      // Özel format
 };
 
+constexpr char kBinaryMagic[4] = {'A', 'L', 'B', 'N'}; // İkili format imzası
+constexpr uint8_t kBinaryVersion = 1;                  // İkili format sürümü
+
 /**
  * @brief Veri serileştirme sınıfı
  * 
@@ -193,6 +198,9 @@ private:
     /**
      * @brief İkili formatında serileştirir
      * 
+     * Biçim: 4 baytlık "ALBN" imzası, 1 baytlık sürüm ve verinin JSON karşılığının
+     * MessagePack kodlaması. JSON ile ifade edilebilen her veri desteklenir.
+     * 
      * @param data Serileştirilecek veri
      * @return Serileştirilmiş veri
      */
@@ -202,6 +210,9 @@ private:
     /**
      * @brief İkili formatında deserileştirir
      * 
+     * İmza uyuşmazsa, sürüm kBinaryVersion değilse veya veri bozuksa varsayılan
+     * değer döndürülür.
+     * 
      * @param serializedData Deserileştirilecek veri
      * @return Deserileştirilmiş veri
      */
@@ -374,14 +385,41 @@ T DataSerializer::deserializeXml(const std::string& serializedData) {
 
 template <typename T>
 std::string DataSerializer::serializeBinary(const T& data) {
-    // TODO: İkili serileştirme kodu eklenecek
-    return "";
+    try {
+        // Veriyi JSON formatına dönüştür
+        nlohmann::json jsonData = data;
+        
+        // Başlığı yaz ve veriyi MessagePack olarak ekle
+        std::string serializedData(kBinaryMagic, sizeof(kBinaryMagic));
+        serializedData.push_back(static_cast<char>(kBinaryVersion));
+        std::vector<std::uint8_t> packed = nlohmann::json::to_msgpack(jsonData);
+        serializedData.append(packed.begin(), packed.end());
+        
+        return serializedData;
+    } catch (const std::exception& e) {
+        return "";
+    }
 }
 
 template <typename T>
 T DataSerializer::deserializeBinary(const std::string& serializedData) {
-    // TODO: İkili deserileştirme kodu eklenecek
-    return T();
+    // Başlığı kontrol et
+    const size_t headerSize = sizeof(kBinaryMagic) + 1;
+    if (serializedData.size() <= headerSize ||
+        serializedData.compare(0, sizeof(kBinaryMagic), kBinaryMagic, sizeof(kBinaryMagic)) != 0 ||
+        static_cast<uint8_t>(serializedData[sizeof(kBinaryMagic)]) != kBinaryVersion) {
+        return T();
+    }
+    
+    try {
+        // MessagePack verisini JSON verisine dönüştür
+        nlohmann::json jsonData = nlohmann::json::from_msgpack(serializedData.data() + headerSize, serializedData.data() + serializedData.size());
+        
+        // JSON verisini veri tipine dönüştür
+        return jsonData.get<T>();
+    } catch (const std::exception& e) {
+        return T();
+    }
 }
 
 template <typename T>
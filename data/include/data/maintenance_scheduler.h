@@ -0,0 +1,212 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <deque>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <cstdint>
+#include <cstddef>
+
+namespace alt_las {
+namespace data {
+
+/**
+ * @brief Veri modülünün ortak bakım zamanlayıcısı
+ *
+ * Temizleme, anlık görüntü, yenileme ve rapor gibi zamanlanmış bakım görevlerini
+ * tek bir iş parçacığında, zamana göre sıralı bir öncelik kuyruğundan çalıştırır.
+ * İş parçacığı bir koşul değişkeniyle en yakın görevin zamanına kadar bekler;
+ * yeni görev veya iptal onu hemen uyandırır. Görevler kısa tutulmalıdır; uzun bir
+ * görev sonraki görevleri geciktirir. Yenileme yükleyicileri gibi süresi bilinmeyen
+ * kullanıcı işlevleri submit() ile ayrı, küçük bir iş havuzunda çalıştırılır.
+ * İş parçacıkları ilk görevle başlatılır. Sınıf iş parçacığı güvenlidir.
+ */
+class MaintenanceScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+    using TaskId = uint64_t;
+
+    static constexpr size_t kWorkerCount = 2; // İş havuzu iş parçacığı sayısı
+
+    /**
+     * @brief Singleton örneğini döndürür
+     *
+     * Zamanlayıcıyı kullanan singleton'lar, yapıcılarında bu örneği alarak
+     * zamanlayıcının kendilerinden sonra yok edilmesini sağlar.
+     *
+     * @return MaintenanceScheduler örneği
+     */
+    static MaintenanceScheduler& getInstance();
+
+    /**
+     * @brief Görevi bir kez çalıştırılmak üzere zamanlar
+     *
+     * @param task Görev
+     * @param delay Gecikme
+     * @return Görev kimliği
+     */
+    TaskId schedule(std::function<void()> task, Clock::duration delay = Clock::duration::zero());
+
+    /**
+     * @brief Görevi periyodik olarak çalıştırılmak üzere zamanlar
+     *
+     * Sonraki çalıştırma, önceki çalıştırmanın bitişinden aralık kadar sonradır.
+     *
+     * @param task Görev
+     * @param interval Çalıştırma aralığı
+     * @param delay İlk çalıştırmaya kadar gecikme
+     * @return Görev kimliği
+     */
+    TaskId scheduleEvery(std::function<void()> task, Clock::duration interval, Clock::duration delay = Clock::duration::zero());
+
+    /**
+     * @brief Görevi iş havuzunda hemen çalıştırılmak üzere ekler
+     *
+     * Havuz görevleri zamanlayıcı iş parçacığında çalışmaz; yavaş veya bekleyen
+     * bir görev temizleme, anlık görüntü ve rapor görevlerini geciktirmez. Tüm
+     * havuz iş parçacıkları meşgulse görev sırada bekler. Görev cancel() ile
+     * iptal edilebilir; reschedule() ile yeniden zamanlanamaz.
+     *
+     * @param task Görev
+     * @return Görev kimliği
+     */
+    TaskId submit(std::function<void()> task);
+
+    /**
+     * @brief Görevin aralığını değiştirir ve sonraki çalıştırmayı yeniden zamanlar
+     *
+     * @param id Görev kimliği
+     * @param interval Yeni aralık; bir kerelik görevler için sonraki çalıştırmaya kadar gecikme
+     * @return Görev bulunduysa true, değilse false
+     */
+    bool reschedule(TaskId id, Clock::duration interval);
+
+    /**
+     * @brief Görevi iptal eder
+     *
+     * İptal edilen görev bir daha başlatılmaz. Görev o sırada başka bir iş
+     * parçacığında çalışıyorsa bitmesi beklenir; böylece çağıran, görevin
+     * kullandığı nesneleri güvenle yok edebilir. Görevin kendi içinden yapılan
+     * iptal beklemez.
+     *
+     * @param id Görev kimliği
+     * @return Görev bekliyor veya çalışıyorduysa true, değilse false
+     */
+    bool cancel(TaskId id);
+
+    /**
+     * @brief Görevin zamanlanmış olup olmadığını kontrol eder
+     *
+     * @param id Görev kimliği
+     * @return Görev bekliyorsa true, değilse false
+     */
+    bool isScheduled(TaskId id) const;
+
+    /**
+     * @brief Bekleyen görev sayısını döndürür
+     *
+     * @return Görev sayısı
+     */
+    size_t size() const;
+
+private:
+    /**
+     * @brief Yapıcı
+     */
+    MaintenanceScheduler();
+
+    /**
+     * @brief Yıkıcı
+     *
+     * Bekleyen görevler çalıştırılmaz.
+     */
+    ~MaintenanceScheduler();
+
+    /**
+     * @brief Kopyalama yapıcısı (engellendi)
+     */
+    MaintenanceScheduler(const MaintenanceScheduler&) = delete;
+
+    /**
+     * @brief Atama operatörü (engellendi)
+     */
+    MaintenanceScheduler& operator=(const MaintenanceScheduler&) = delete;
+
+    /**
+     * @brief Zamanlanmış görev
+     */
+    struct Task {
+        std::shared_ptr<std::function<void()>> function; // Görev işlevi
+        Clock::duration interval;                        // Periyodik aralık, sıfırsa bir kerelik
+        uint64_t sequence;                               // Geçerli kuyruk kaydının sıra numarası
+        bool pooled;                                     // İş havuzunda mı çalışır?
+    };
+
+    /**
+     * @brief Kuyruk kaydı
+     *
+     * Yeniden zamanlanan veya iptal edilen görevlerin eski kayıtları, sıra numarası
+     * görevinkiyle eşleşmediği için kuyruktan çıkarken atlanır.
+     */
+    struct QueueItem {
+        Clock::time_point due; // Çalıştırma zamanı
+        uint64_t sequence;     // Sıra numarası (aynı zamandakiler için ekleme sırası)
+        TaskId id;             // Görev kimliği
+
+        bool operator>(const QueueItem& other) const {
+            return due != other.due ? due > other.due : sequence > other.sequence;
+        }
+    };
+
+    /**
+     * @brief Görevi kuyruğa ekler (kilit tutulurken çağrılır)
+     *
+     * @param id Görev kimliği
+     * @param task Görev
+     * @param due Çalıştırma zamanı
+     */
+    void push(TaskId id, Task& task, Clock::time_point due);
+
+    /**
+     * @brief Görevin başka bir iş parçacığında çalışıp çalışmadığını kontrol eder (kilit tutulurken çağrılır)
+     *
+     * @param id Görev kimliği
+     * @return Çağıran dışında bir iş parçacığında çalışıyorsa true, değilse false
+     */
+    bool isRunningElsewhere(TaskId id) const;
+
+    /**
+     * @brief Zamanlayıcı döngüsü
+     */
+    void run();
+
+    /**
+     * @brief İş havuzu döngüsü
+     */
+    void runWorker();
+
+    std::unordered_map<TaskId, Task> tasks_; // Bekleyen görevler
+    std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<QueueItem>> queue_; // Zamana göre kuyruk
+    TaskId nextId_;                      // Sonraki görev kimliği
+    uint64_t nextSequence_;              // Sonraki sıra numarası
+    TaskId runningId_;                   // Çalışan görev, yoksa 0
+    bool running_;                       // İş parçacığı çalışıyor mu?
+    bool stopping_;                      // Durdurma istendi mi?
+    std::thread thread_;                 // Zamanlayıcı iş parçacığı
+    std::deque<TaskId> ready_;           // İş havuzunda çalışmayı bekleyen görevler
+    std::vector<std::pair<TaskId, std::thread::id>> workerRunning_; // İş havuzunda çalışan görevler
+    std::vector<std::thread> workers_;   // İş havuzu iş parçacıkları
+    std::condition_variable condition_;  // Yeni görev veya durdurma koşulu
+    std::condition_variable workAvailable_; // Yeni havuz görevi veya durdurma koşulu
+    std::condition_variable finished_;   // Görev bitişi koşulu
+    mutable std::mutex mutex_;           // Zamanlayıcı mutex'i
+};
+
+} // namespace data
+} // namespace alt_las
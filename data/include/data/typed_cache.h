@@ -0,0 +1,882 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <algorithm>
+#include "data/cache_clock.h"
+#include "data/cache_eviction.h"
+#include "data/cache_expiry.h"
+#include "data/cache_size.h"
+#include "data/cache_stats.h"
+#include "data/cache_tags.h"
+#include "data/maintenance_scheduler.h"
+
+namespace alt_las {
+namespace data {
+
+/**
+ * @brief Tür güvenli önbellek
+ *
+ * DataCache ile aynı özellikleri (yaşam süresi, etiketler, kapasite, bellek bütçesi,
+ * tahliye politikası, istatistikler, otomatik temizleme) std::any kullanmadan sunar.
+ * Değerler doğrudan girdinin içinde tutulur; okuma sırasında tür denetimi yapılmaz.
+ */
+template <typename K, typename V, typename Hash = std::hash<K>>
+class TypedCache {
+public:
+    using Clock = CoarseClock;
+
+    /**
+     * @brief Yapıcı
+     *
+     * @param capacity Önbellek kapasitesi
+     * @param defaultTtl Varsayılan yaşam süresi
+     * @param shardCount Parça sayısı (2'nin kuvvetine yuvarlanır)
+     */
+    explicit TypedCache(size_t capacity = 1000, std::chrono::seconds defaultTtl = std::chrono::seconds(3600), size_t shardCount = 1);
+
+    /**
+     * @brief Yıkıcı
+     */
+    ~TypedCache();
+
+    /**
+     * @brief Kopyalama yapıcısı (engellendi)
+     */
+    TypedCache(const TypedCache&) = delete;
+
+    /**
+     * @brief Atama operatörü (engellendi)
+     */
+    TypedCache& operator=(const TypedCache&) = delete;
+
+    /**
+     * @brief Önbelleğe veri ekler
+     *
+     * @param key Anahtar
+     * @param value Veri
+     * @param ttl Yaşam süresi (saniye)
+     * @param tags Etiketler (virgül, noktalı virgül veya boşlukla ayrılmış)
+     * @param size Değerin boyutu (bayt), 0 ise CacheSizeEstimator ile tahmin edilir
+     */
+    void set(const K& key, V value, std::chrono::seconds ttl = std::chrono::seconds(0), const std::string& tags = "", size_t size = 0);
+
+    /**
+     * @brief Önbellekten veri alır
+     *
+     * @param key Anahtar
+     * @param value Bulunan veri
+     * @return Veri bulunduysa true, değilse false
+     */
+    bool tryGet(const K& key, V& value);
+
+    /**
+     * @brief Dizge anahtarlı önbellekten geçici dizge oluşturmadan veri alır
+     *
+     * @param key Anahtar
+     * @param value Bulunan veri
+     * @return Veri bulunduysa true, değilse false
+     */
+    template <typename Key = K, typename = std::enable_if_t<std::is_same<Key, std::string>::value>>
+    bool tryGet(std::string_view key, V& value);
+
+    /**
+     * @brief Önbellekten veri alır
+     *
+     * @param key Anahtar
+     * @param defaultValue Varsayılan değer
+     * @return Veri
+     */
+    V get(const K& key, const V& defaultValue = V());
+
+    /**
+     * @brief Önbellekten veri siler
+     *
+     * @param key Anahtar
+     * @return Silme başarılıysa true, değilse false
+     */
+    bool remove(const K& key);
+
+    /**
+     * @brief Dizge anahtarlı önbellekten geçici dizge oluşturmadan veri siler
+     *
+     * @param key Anahtar
+     * @return Silme başarılıysa true, değilse false
+     */
+    template <typename Key = K, typename = std::enable_if_t<std::is_same<Key, std::string>::value>>
+    bool remove(std::string_view key);
+
+    /**
+     * @brief Önbellekte anahtar varlığını kontrol eder
+     *
+     * @param key Anahtar
+     * @return Anahtar varsa true, yoksa false
+     */
+    bool has(const K& key);
+
+    /**
+     * @brief Dizge anahtarlı önbellekte geçici dizge oluşturmadan anahtar varlığını kontrol eder
+     *
+     * @param key Anahtar
+     * @return Anahtar varsa true, yoksa false
+     */
+    template <typename Key = K, typename = std::enable_if_t<std::is_same<Key, std::string>::value>>
+    bool has(std::string_view key);
+
+    /**
+     * @brief Önbelleği temizler
+     */
+    void clear();
+
+    /**
+     * @brief Süresi dolmuş girdileri temizler
+     *
+     * @return Temizlenen girdi sayısı
+     */
+    size_t clearExpired();
+
+    /**
+     * @brief Etiketlere göre girdileri temizler
+     *
+     * @param tags Etiketler
+     * @return Temizlenen girdi sayısı
+     */
+    size_t clearByTags(const std::string& tags);
+
+    /**
+     * @brief Etiketi taşıyan anahtarları döndürür
+     *
+     * @param tag Etiket
+     * @return Anahtarlar
+     */
+    std::vector<K> getKeysByTag(const std::string& tag) const;
+
+    /**
+     * @brief Önbellek boyutunu döndürür
+     *
+     * @return Önbellek boyutu
+     */
+    size_t size() const;
+
+    /**
+     * @brief Önbellek kapasitesini döndürür
+     *
+     * @return Önbellek kapasitesi
+     */
+    size_t capacity() const;
+
+    /**
+     * @brief Önbellek kapasitesini ayarlar
+     *
+     * @param capacity Önbellek kapasitesi
+     */
+    void setCapacity(size_t capacity);
+
+    /**
+     * @brief Bellek bütçesini döndürür
+     *
+     * @return Bellek bütçesi (bayt), 0 ise sınırsız
+     */
+    size_t getMemoryBudget() const;
+
+    /**
+     * @brief Bellek bütçesini ayarlar
+     *
+     * @param bytes Bellek bütçesi (bayt), 0 ise sınırsız
+     */
+    void setMemoryBudget(size_t bytes);
+
+    /**
+     * @brief Girdilerin toplam tahmini boyutunu döndürür
+     *
+     * @return Bellek kullanımı (bayt)
+     */
+    size_t memoryUsage() const;
+
+    /**
+     * @brief Tahliye politikasını döndürür
+     *
+     * @return Tahliye politikası
+     */
+    EvictionPolicy getEvictionPolicy() const;
+
+    /**
+     * @brief Tahliye politikasını ayarlar
+     *
+     * @param policy Tahliye politikası
+     */
+    void setEvictionPolicy(EvictionPolicy policy);
+
+    /**
+     * @brief Parça sayısını döndürür
+     *
+     * @return Parça sayısı
+     */
+    size_t getShardCount() const;
+
+    /**
+     * @brief Varsayılan yaşam süresini döndürür
+     *
+     * @return Varsayılan yaşam süresi
+     */
+    std::chrono::seconds getDefaultTtl() const;
+
+    /**
+     * @brief Varsayılan yaşam süresini ayarlar
+     *
+     * @param ttl Varsayılan yaşam süresi
+     */
+    void setDefaultTtl(std::chrono::seconds ttl);
+
+    /**
+     * @brief Otomatik temizleme aralığını döndürür
+     *
+     * @return Otomatik temizleme aralığı
+     */
+    std::chrono::seconds getCleanupInterval() const;
+
+    /**
+     * @brief Otomatik temizleme aralığını ayarlar
+     *
+     * @param interval Otomatik temizleme aralığı
+     */
+    void setCleanupInterval(std::chrono::seconds interval);
+
+    /**
+     * @brief Otomatik temizlemeyi başlatır
+     *
+     * @return Başlatma başarılıysa true, değilse false
+     */
+    bool startAutoCleanup();
+
+    /**
+     * @brief Otomatik temizlemeyi durdurur
+     *
+     * Temizleme görevi bakım zamanlayıcısından hemen çıkarılır; çalışan bir
+     * temizleme varsa bitmesi beklenir.
+     *
+     * @return Durdurma başarılıysa true, değilse false
+     */
+    bool stopAutoCleanup();
+
+    /**
+     * @brief Otomatik temizlemenin çalışıp çalışmadığını kontrol eder
+     *
+     * @return Otomatik temizleme çalışıyorsa true, değilse false
+     */
+    bool isAutoCleanupRunning() const;
+
+    /**
+     * @brief Önbellek istatistiklerini döndürür
+     *
+     * @return Önbellek istatistikleri
+     */
+    std::unordered_map<std::string, size_t> getStats() const;
+
+    /**
+     * @brief Önbellek istatistiklerini sıfırlar
+     */
+    void resetStats();
+
+    static constexpr size_t kMaxShardCount = 256;   // En fazla parça sayısı
+    static constexpr size_t kExpirySliceSize = 256; // Kilit başına temizlenen en fazla girdi
+
+private:
+    /**
+     * @brief Önbellek girdisi
+     */
+    struct Entry : EvictionHook {
+        const K* key = nullptr;                 // Haritadaki anahtar
+        V value;                                // Veri
+        Clock::time_point expiresAt;            // Sona erme zamanı
+        std::vector<std::string> tags;          // Etiketler (sıralı)
+        size_t size = 0;                        // Tahmini boyut (bayt)
+    };
+
+    using EntryMap = std::unordered_map<K, Entry, Hash>;
+
+    /**
+     * @brief Önbellek parçası
+     */
+    struct alignas(64) Shard {
+        EntryMap entries;                       // Parça girdileri
+        EvictionList eviction;                  // Tahliye listesi
+        ExpiryQueue<K, Clock::time_point> expiry; // Sona erme kuyruğu
+        TagIndex<K, Hash> tags;                 // Etiket dizini
+        size_t bytes = 0;                       // Girdilerin toplam boyutu
+        mutable std::mutex mutex;               // Parça mutex'i
+    };
+
+    /**
+     * @brief Anahtarın parçasını döndürür
+     *
+     * @param key Anahtar
+     * @return Parça
+     */
+    Shard& shardFor(const K& key) const;
+
+    /**
+     * @brief Dizge görünümünü arama anahtarına çevirir
+     *
+     * C++17 std::unordered_map türler arası arama desteklemediği için anahtar, iş
+     * parçacığı yerel bir tampona kopyalanır; tampon büyüdükten sonra bellek ayrılmaz.
+     *
+     * @param key Anahtar
+     * @return Bir sonraki çağrıya kadar geçerli arama anahtarı
+     */
+    static const K& lookupKey(std::string_view key);
+
+    /**
+     * @brief Girdinin süresinin dolup dolmadığını kontrol eder
+     *
+     * @param entry Girdi
+     * @param now Şimdiki zaman
+     * @return Süresi dolduysa true, değilse false
+     */
+    static bool isExpired(const Entry& entry, Clock::time_point now);
+
+    /**
+     * @brief Parça kapasitesini ve bütçesini kontrol eder
+     *
+     * @param shard Kilitli parça
+     */
+    void checkCapacity(Shard& shard);
+
+    /**
+     * @brief Eski kayıtlar canlı girdileri fazlasıyla aşmışsa sona erme kuyruğunu sıkıştırır
+     *
+     * @param shard Kilitli parça
+     */
+    void compactExpiry(Shard& shard);
+
+    /**
+     * @brief Girdiyi parçadan siler
+     *
+     * @param shard Kilitli parça
+     * @param it Girdi
+     * @return Sonraki girdi
+     */
+    typename EntryMap::iterator eraseEntry(Shard& shard, typename EntryMap::iterator it);
+
+    std::unique_ptr<Shard[]> shards_; // Önbellek parçaları
+    size_t shardCount_; // Parça sayısı
+    std::atomic<size_t> capacity_; // Önbellek kapasitesi
+    std::atomic<size_t> memoryBudget_; // Bellek bütçesi (bayt)
+    std::atomic<EvictionPolicy> evictionPolicy_; // Tahliye politikası
+    std::atomic<std::chrono::seconds::rep> defaultTtl_; // Varsayılan yaşam süresi
+    std::atomic<std::chrono::seconds::rep> cleanupInterval_; // Otomatik temizleme aralığı
+    MaintenanceScheduler& scheduler_; // Bakım zamanlayıcısı
+    MaintenanceScheduler::TaskId cleanupTask_; // Otomatik temizleme görevi, yoksa 0
+    mutable std::mutex autoCleanupMutex_; // Otomatik temizleme mutex'i
+    CacheStatCounters stats_; // Önbellek istatistikleri
+};
+
+template <typename K, typename V, typename Hash>
+TypedCache<K, V, Hash>::TypedCache(size_t capacity, std::chrono::seconds defaultTtl, size_t shardCount)
+    : shardCount_(1),
+      capacity_(capacity),
+      memoryBudget_(0),
+      evictionPolicy_(EvictionPolicy::LRU),
+      defaultTtl_(defaultTtl.count()),
+      cleanupInterval_(300),
+      scheduler_(MaintenanceScheduler::getInstance()),
+      cleanupTask_(0) {
+
+    // Parça sayısını 2'nin kuvvetine yuvarla
+    while (shardCount_ < shardCount && shardCount_ < kMaxShardCount) {
+        shardCount_ <<= 1;
+    }
+
+    shards_.reset(new Shard[shardCount_]);
+
+    // Saat iş parçacığı önbellekten sonra durdurulsun diye önce başlatılır
+    CoarseClock::start();
+}
+
+template <typename K, typename V, typename Hash>
+TypedCache<K, V, Hash>::~TypedCache() {
+    // Otomatik temizlemeyi durdur
+    stopAutoCleanup();
+}
+
+template <typename K, typename V, typename Hash>
+void TypedCache<K, V, Hash>::set(const K& key, V value, std::chrono::seconds ttl, const std::string& tags, size_t size) {
+    // Etiketleri ve boyutu kilit dışında hesapla
+    std::vector<std::string> parsedTags = parseCacheTags(tags);
+    size_t entrySize = (size > 0 ? size : estimateCacheSize(value)) + estimateCacheSize(key);
+
+    // Yaşam süresini ayarla
+    if (ttl.count() == 0) {
+        ttl = std::chrono::seconds(defaultTtl_.load());
+    }
+
+    Shard& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    // Önbellek girdisini bul veya oluştur
+    auto result = shard.entries.try_emplace(key);
+    Entry& entry = result.first->second;
+    if (!result.second) {
+        shard.eviction.erase(&entry);
+        shard.tags.remove(key, entry.tags);
+        shard.bytes -= entry.size;
+    }
+
+    entry.key = &result.first->first;
+    entry.value = std::move(value);
+
+    // Sona erme zamanını ayarla
+    if (ttl.count() > 0) {
+        entry.expiresAt = Clock::now() + ttl;
+        shard.expiry.push(key, entry.expiresAt);
+        compactExpiry(shard);
+    } else {
+        entry.expiresAt = Clock::time_point::max();
+    }
+
+    entry.tags = std::move(parsedTags);
+    shard.tags.add(key, entry.tags);
+
+    entry.size = entrySize;
+    shard.bytes += entrySize;
+
+    // Tahliye listesine ekle
+    shard.eviction.insert(&entry);
+
+    // Parça kapasitesini kontrol et
+    checkCapacity(shard);
+
+    // İstatistikleri güncelle
+    stats_.add(CacheStat::SET);
+}
+
+template <typename K, typename V, typename Hash>
+bool TypedCache<K, V, Hash>::tryGet(const K& key, V& value) {
+    Shard& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    // Anahtarı kontrol et
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end()) {
+        stats_.add(CacheStat::MISS);
+        return false;
+    }
+
+    // Sona erme zamanını kontrol et
+    if (isExpired(it->second, Clock::now())) {
+        eraseEntry(shard, it);
+
+        stats_.add(CacheStat::EXPIRED);
+        stats_.add(CacheStat::MISS);
+        return false;
+    }
+
+    // Kullanımı bildir
+    shard.eviction.touch(&it->second);
+
+    stats_.add(CacheStat::HIT);
+    value = it->second.value;
+
+    return true;
+}
+
+template <typename K, typename V, typename Hash>
+template <typename Key, typename>
+bool TypedCache<K, V, Hash>::tryGet(std::string_view key, V& value) {
+    return tryGet(lookupKey(key), value);
+}
+
+template <typename K, typename V, typename Hash>
+V TypedCache<K, V, Hash>::get(const K& key, const V& defaultValue) {
+    V value;
+    if (tryGet(key, value)) {
+        return value;
+    }
+
+    return defaultValue;
+}
+
+template <typename K, typename V, typename Hash>
+bool TypedCache<K, V, Hash>::remove(const K& key) {
+    Shard& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    // Anahtarı kontrol et
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end()) {
+        return false;
+    }
+
+    // Önbellekten sil
+    eraseEntry(shard, it);
+
+    stats_.add(CacheStat::REMOVE);
+
+    return true;
+}
+
+template <typename K, typename V, typename Hash>
+template <typename Key, typename>
+bool TypedCache<K, V, Hash>::remove(std::string_view key) {
+    return remove(lookupKey(key));
+}
+
+template <typename K, typename V, typename Hash>
+bool TypedCache<K, V, Hash>::has(const K& key) {
+    Shard& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    // Anahtarı kontrol et
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end()) {
+        return false;
+    }
+
+    // Sona erme zamanını kontrol et
+    if (isExpired(it->second, Clock::now())) {
+        eraseEntry(shard, it);
+
+        stats_.add(CacheStat::EXPIRED);
+        return false;
+    }
+
+    return true;
+}
+
+template <typename K, typename V, typename Hash>
+template <typename Key, typename>
+bool TypedCache<K, V, Hash>::has(std::string_view key) {
+    return has(lookupKey(key));
+}
+
+template <typename K, typename V, typename Hash>
+void TypedCache<K, V, Hash>::clear() {
+    // Parçaları tek tek temizle
+    for (size_t i = 0; i < shardCount_; i++) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        shards_[i].entries.clear();
+        shards_[i].eviction.clear();
+        shards_[i].expiry.clear();
+        shards_[i].tags.clear();
+        shards_[i].bytes = 0;
+    }
+
+    stats_.add(CacheStat::CLEAR);
+}
+
+template <typename K, typename V, typename Hash>
+size_t TypedCache<K, V, Hash>::clearExpired() {
+    size_t count = 0;
+    auto now = Clock::now();
+
+    // Süresi dolmuş girdileri parça parça, dilimler halinde temizle
+    for (size_t i = 0; i < shardCount_; i++) {
+        Shard& shard = shards_[i];
+        size_t popped = kExpirySliceSize;
+
+        while (popped == kExpirySliceSize) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+
+            popped = shard.expiry.popDue(now, kExpirySliceSize, [&](const K& key, Clock::time_point expiresAt) {
+                // Silinmiş veya yeniden yazılmış girdilerin kayıtlarını atla
+                auto it = shard.entries.find(key);
+                if (it != shard.entries.end() && it->second.expiresAt == expiresAt) {
+                    eraseEntry(shard, it);
+                    count++;
+                }
+            });
+
+            if (popped < kExpirySliceSize) {
+                compactExpiry(shard);
+            }
+        }
+    }
+
+    stats_.add(CacheStat::EXPIRED, count);
+    stats_.add(CacheStat::CLEAR_EXPIRED);
+
+    return count;
+}
+
+template <typename K, typename V, typename Hash>
+size_t TypedCache<K, V, Hash>::clearByTags(const std::string& tags) {
+    size_t count = 0;
+    std::vector<std::string> parsedTags = parseCacheTags(tags);
+
+    // Etiketlere göre girdileri parça parça temizle
+    for (size_t i = 0; !parsedTags.empty() && i < shardCount_; i++) {
+        Shard& shard = shards_[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        std::vector<K> keys = shard.tags.match(parsedTags, [&shard](const K& key, const std::string& tag) {
+            const auto& entryTags = shard.entries.at(key).tags;
+            return std::binary_search(entryTags.begin(), entryTags.end(), tag);
+        });
+
+        for (const auto& key : keys) {
+            eraseEntry(shard, shard.entries.find(key));
+            count++;
+        }
+    }
+
+    stats_.add(CacheStat::CLEAR_BY_TAGS);
+
+    return count;
+}
+
+template <typename K, typename V, typename Hash>
+std::vector<K> TypedCache<K, V, Hash>::getKeysByTag(const std::string& tag) const {
+    std::vector<K> keys;
+
+    for (size_t i = 0; i < shardCount_; i++) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+
+        const auto* shardKeys = shards_[i].tags.find(tag);
+        if (shardKeys != nullptr) {
+            keys.insert(keys.end(), shardKeys->begin(), shardKeys->end());
+        }
+    }
+
+    return keys;
+}
+
+template <typename K, typename V, typename Hash>
+size_t TypedCache<K, V, Hash>::size() const {
+    size_t total = 0;
+
+    for (size_t i = 0; i < shardCount_; i++) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        total += shards_[i].entries.size();
+    }
+
+    return total;
+}
+
+template <typename K, typename V, typename Hash>
+size_t TypedCache<K, V, Hash>::capacity() const {
+    return capacity_.load();
+}
+
+template <typename K, typename V, typename Hash>
+void TypedCache<K, V, Hash>::setCapacity(size_t capacity) {
+    capacity_ = capacity;
+
+    for (size_t i = 0; i < shardCount_; i++) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        checkCapacity(shards_[i]);
+    }
+}
+
+template <typename K, typename V, typename Hash>
+size_t TypedCache<K, V, Hash>::getMemoryBudget() const {
+    return memoryBudget_.load();
+}
+
+template <typename K, typename V, typename Hash>
+void TypedCache<K, V, Hash>::setMemoryBudget(size_t bytes) {
+    memoryBudget_ = bytes;
+
+    for (size_t i = 0; i < shardCount_; i++) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        checkCapacity(shards_[i]);
+    }
+}
+
+template <typename K, typename V, typename Hash>
+size_t TypedCache<K, V, Hash>::memoryUsage() const {
+    size_t total = 0;
+
+    for (size_t i = 0; i < shardCount_; i++) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        total += shards_[i].bytes;
+    }
+
+    return total;
+}
+
+template <typename K, typename V, typename Hash>
+EvictionPolicy TypedCache<K, V, Hash>::getEvictionPolicy() const {
+    return evictionPolicy_.load();
+}
+
+template <typename K, typename V, typename Hash>
+void TypedCache<K, V, Hash>::setEvictionPolicy(EvictionPolicy policy) {
+    evictionPolicy_ = policy;
+
+    for (size_t i = 0; i < shardCount_; i++) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        shards_[i].eviction.setPolicy(policy);
+    }
+}
+
+template <typename K, typename V, typename Hash>
+size_t TypedCache<K, V, Hash>::getShardCount() const {
+    return shardCount_;
+}
+
+template <typename K, typename V, typename Hash>
+std::chrono::seconds TypedCache<K, V, Hash>::getDefaultTtl() const {
+    return std::chrono::seconds(defaultTtl_.load());
+}
+
+template <typename K, typename V, typename Hash>
+void TypedCache<K, V, Hash>::setDefaultTtl(std::chrono::seconds ttl) {
+    defaultTtl_ = ttl.count();
+}
+
+template <typename K, typename V, typename Hash>
+std::chrono::seconds TypedCache<K, V, Hash>::getCleanupInterval() const {
+    return std::chrono::seconds(cleanupInterval_.load());
+}
+
+template <typename K, typename V, typename Hash>
+void TypedCache<K, V, Hash>::setCleanupInterval(std::chrono::seconds interval) {
+    std::lock_guard<std::mutex> lock(autoCleanupMutex_);
+
+    cleanupInterval_ = std::max<std::chrono::seconds::rep>(interval.count(), 1);
+
+    // Çalışan temizleme görevini yeni aralıkla yeniden zamanla
+    if (cleanupTask_ != 0) {
+        scheduler_.reschedule(cleanupTask_, getCleanupInterval());
+    }
+}
+
+template <typename K, typename V, typename Hash>
+bool TypedCache<K, V, Hash>::startAutoCleanup() {
+    std::lock_guard<std::mutex> lock(autoCleanupMutex_);
+
+    // Eğer otomatik temizleme zaten çalışıyorsa, false döndür
+    if (cleanupTask_ != 0) {
+        return false;
+    }
+
+    // Temizleme görevini zamanla, ilk temizleme hemen yapılır
+    cleanupTask_ = scheduler_.scheduleEvery([this]() {
+        clearExpired();
+    }, getCleanupInterval());
+
+    return true;
+}
+
+template <typename K, typename V, typename Hash>
+bool TypedCache<K, V, Hash>::stopAutoCleanup() {
+    MaintenanceScheduler::TaskId task;
+    {
+        std::lock_guard<std::mutex> lock(autoCleanupMutex_);
+        task = cleanupTask_;
+        cleanupTask_ = 0;
+    }
+
+    // Görevi iptal et; çalışan temizlemenin bitmesi beklenir
+    if (task != 0) {
+        scheduler_.cancel(task);
+    }
+
+    return true;
+}
+
+template <typename K, typename V, typename Hash>
+bool TypedCache<K, V, Hash>::isAutoCleanupRunning() const {
+    std::lock_guard<std::mutex> lock(autoCleanupMutex_);
+    return cleanupTask_ != 0;
+}
+
+template <typename K, typename V, typename Hash>
+std::unordered_map<std::string, size_t> TypedCache<K, V, Hash>::getStats() const {
+    auto stats = stats_.snapshot();
+
+    size_t entries = 0;
+    size_t bytes = 0;
+    for (size_t i = 0; i < shardCount_; i++) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        entries += shards_[i].entries.size();
+        bytes += shards_[i].bytes;
+    }
+
+    stats["bytes"] = bytes;
+    stats["memoryBudget"] = memoryBudget_.load();
+    stats["averageEntryBytes"] = entries == 0 ? 0 : bytes / entries;
+
+    return stats;
+}
+
+template <typename K, typename V, typename Hash>
+void TypedCache<K, V, Hash>::resetStats() {
+    stats_.reset();
+}
+
+template <typename K, typename V, typename Hash>
+typename TypedCache<K, V, Hash>::Shard& TypedCache<K, V, Hash>::shardFor(const K& key) const {
+    return shards_[Hash()(key) & (shardCount_ - 1)];
+}
+
+template <typename K, typename V, typename Hash>
+const K& TypedCache<K, V, Hash>::lookupKey(std::string_view key) {
+    thread_local K buffer;
+    buffer.assign(key.data(), key.size());
+    return buffer;
+}
+
+template <typename K, typename V, typename Hash>
+bool TypedCache<K, V, Hash>::isExpired(const Entry& entry, Clock::time_point now) {
+    return entry.expiresAt != Clock::time_point::max() && entry.expiresAt <= now;
+}
+
+template <typename K, typename V, typename Hash>
+void TypedCache<K, V, Hash>::compactExpiry(Shard& shard) {
+    // Sıkıştırmadan sonra yalnızca canlı kayıtlar kalır; maliyet sonraki yazmalara yayılır
+    if (shard.expiry.size() <= 2 * shard.entries.size() + kExpirySliceSize) {
+        return;
+    }
+
+    shard.expiry.compact([&shard](const K& key, Clock::time_point expiresAt) {
+        auto it = shard.entries.find(key);
+        return it != shard.entries.end() && it->second.expiresAt == expiresAt;
+    });
+}
+
+template <typename K, typename V, typename Hash>
+void TypedCache<K, V, Hash>::checkCapacity(Shard& shard) {
+    size_t capacity = (capacity_.load() + shardCount_ - 1) / shardCount_;
+    size_t budget = memoryBudget_.load();
+    size_t shardBudget = budget == 0 ? 0 : (budget + shardCount_ - 1) / shardCount_;
+
+    auto exceeded = [&]() {
+        return shard.entries.size() > capacity || (shardBudget > 0 && shard.bytes > shardBudget);
+    };
+
+    // Eğer parça kapasitesi veya bütçesi aşılmışsa, politikanın seçtiği girdileri sil
+    if (exceeded()) {
+        while (exceeded()) {
+            auto* entry = static_cast<Entry*>(shard.eviction.victim());
+            if (entry == nullptr) {
+                break;
+            }
+
+            eraseEntry(shard, shard.entries.find(*entry->key));
+        }
+
+        stats_.add(CacheStat::CAPACITY_EXCEEDED);
+    }
+}
+
+template <typename K, typename V, typename Hash>
+typename TypedCache<K, V, Hash>::EntryMap::iterator TypedCache<K, V, Hash>::eraseEntry(Shard& shard, typename EntryMap::iterator it) {
+    // Tahliye listesinden ve etiket dizininden çıkar
+    shard.eviction.erase(&it->second);
+    shard.tags.remove(it->first, it->second.tags);
+    shard.bytes -= it->second.size;
+
+    return shard.entries.erase(it);
+}
+
+} // namespace data
+} // namespace alt_las
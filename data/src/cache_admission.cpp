@@ -0,0 +1,97 @@
+#include "data/cache_admission.h"
+#include <algorithm>
+
+namespace alt_las {
+namespace data {
+
+void FrequencySketch::ensureCapacity(size_t capacity) {
+    capacity = std::max<size_t>(capacity, 1);
+    if (capacity == capacity_) {
+        return;
+    }
+
+    // Girdi başına bir kelime (16 sayaç) ayır; dar tablo çakışmalarla tahminleri şişirir
+    size_t words = 1;
+    while (words < capacity) {
+        words <<= 1;
+    }
+
+    table_.assign(words, 0);
+    capacity_ = capacity;
+    additions_ = 0;
+    sampleSize_ = 10 * capacity;
+}
+
+void FrequencySketch::increment(uint64_t hash) {
+    if (table_.empty()) {
+        return;
+    }
+
+    bool added = false;
+
+    // Her satırdaki sayacı doygunluğa kadar artır
+    for (size_t row = 0; row < kDepth; row++) {
+        size_t word;
+        unsigned shift;
+        locate(hash, row, word, shift);
+
+        if (((table_[word] >> shift) & kMaxCount) < kMaxCount) {
+            table_[word] += uint64_t(1) << shift;
+            added = true;
+        }
+    }
+
+    // Örnek boyutuna ulaşıldıysa yaşlandır
+    if (added && ++additions_ >= sampleSize_) {
+        age();
+    }
+}
+
+uint32_t FrequencySketch::estimate(uint64_t hash) const {
+    if (table_.empty()) {
+        return 0;
+    }
+
+    uint64_t frequency = kMaxCount;
+
+    // Satırlardaki en küçük sayaç tahmindir
+    for (size_t row = 0; row < kDepth; row++) {
+        size_t word;
+        unsigned shift;
+        locate(hash, row, word, shift);
+
+        frequency = std::min(frequency, (table_[word] >> shift) & kMaxCount);
+    }
+
+    return static_cast<uint32_t>(frequency);
+}
+
+void FrequencySketch::clear() {
+    std::fill(table_.begin(), table_.end(), 0);
+    additions_ = 0;
+}
+
+void FrequencySketch::locate(uint64_t hash, size_t row, size_t& word, unsigned& shift) const {
+    static const uint64_t seeds[kDepth] = {
+        0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL, 0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL
+    };
+
+    // Satıra özgü tohumla karıştır
+    uint64_t h = (hash + seeds[row]) * 0x9e3779b97f4a7c15ULL;
+    h ^= h >> 32;
+
+    word = static_cast<size_t>(h) & (table_.size() - 1);
+    shift = static_cast<unsigned>((h >> 60) & 15) * 4;
+}
+
+void FrequencySketch::age() {
+    // Her 4 bitlik sayacı yarıya indir
+    for (auto& value : table_) {
+        value = (value >> 1) & 0x7777777777777777ULL;
+    }
+
+    additions_ /= 2;
+}
+
+} // namespace data
+} // namespace alt_las
@@ -0,0 +1,78 @@
+#include "data/cache_clock.h"
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace alt_las {
+namespace data {
+
+namespace {
+
+/**
+ * @brief Kaba saati güncelleyen iş parçacığı
+ */
+class ClockTicker {
+public:
+    explicit ClockTicker(std::atomic<CoarseClock::rep>& ticks)
+        : ticks_(ticks),
+          running_(true) {
+        update();
+        thread_ = std::thread(&ClockTicker::run, this);
+    }
+
+    ~ClockTicker() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            running_ = false;
+        }
+        condition_.notify_all();
+
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    void update() {
+        // Sıfır "başlamadı" anlamına geldiği için en az 1 yazılır
+        auto ticks = std::chrono::steady_clock::now().time_since_epoch().count();
+        ticks_.store(std::max<CoarseClock::rep>(ticks, 1), std::memory_order_relaxed);
+    }
+
+private:
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        while (!condition_.wait_for(lock, CoarseClock::kResolution, [this]() { return !running_; })) {
+            update();
+        }
+    }
+
+    std::atomic<CoarseClock::rep>& ticks_; // Güncellenen tikler
+    bool running_;                         // İş parçacığı çalışıyor mu?
+    std::thread thread_;                   // Güncelleme iş parçacığı
+    std::condition_variable condition_;    // Durdurma koşulu
+    std::mutex mutex_;                     // Durdurma mutex'i
+};
+
+} // namespace
+
+CoarseClock::rep CoarseClock::start() {
+    // Durdurulduktan sonra saat son değerinde kalır; iş parçacığı yeniden başlatılmaz
+    static ClockTicker ticker(ticks_);
+
+    return ticks_.load(std::memory_order_relaxed);
+}
+
+std::chrono::system_clock::time_point CoarseClock::toSystem(time_point time) {
+    auto offset = time - now();
+    return std::chrono::system_clock::now() + std::chrono::duration_cast<std::chrono::system_clock::duration>(offset);
+}
+
+CoarseClock::time_point CoarseClock::fromSystem(std::chrono::system_clock::time_point time) {
+    auto offset = time - std::chrono::system_clock::now();
+    return now() + std::chrono::duration_cast<duration>(offset);
+}
+
+} // namespace data
+} // namespace alt_las
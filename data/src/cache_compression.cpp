@@ -0,0 +1,181 @@
+#include "data/cache_compression.h"
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include <stdexcept>
+
+namespace alt_las {
+namespace data {
+
+namespace {
+
+constexpr size_t kMinMatch = 4;             // En kısa eşleşme
+constexpr size_t kLastLiterals = 5;         // Sona değişmez olarak bırakılan bayt sayısı
+constexpr size_t kMaxOffset = 65535;        // En büyük eşleşme uzaklığı
+constexpr unsigned kHashBits = 12;          // Karma tablosu bit sayısı
+
+uint32_t read32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+void writeLength(std::string& out, size_t length) {
+    while (length >= 255) {
+        out.push_back(static_cast<char>(255));
+        length -= 255;
+    }
+    out.push_back(static_cast<char>(length));
+}
+
+void writeSequence(std::string& out, const uint8_t* literals, size_t literalLength, size_t offset, size_t matchLength) {
+    size_t matchCode = matchLength == 0 ? 0 : matchLength - kMinMatch;
+    uint8_t token = static_cast<uint8_t>((std::min<size_t>(literalLength, 15) << 4) | std::min<size_t>(matchCode, 15));
+    out.push_back(static_cast<char>(token));
+
+    if (literalLength >= 15) {
+        writeLength(out, literalLength - 15);
+    }
+    out.append(reinterpret_cast<const char*>(literals), literalLength);
+
+    // Son dizide eşleşme yoktur
+    if (matchLength == 0) {
+        return;
+    }
+
+    out.push_back(static_cast<char>(offset & 0xFF));
+    out.push_back(static_cast<char>(offset >> 8));
+    if (matchCode >= 15) {
+        writeLength(out, matchCode - 15);
+    }
+}
+
+bool readLength(const uint8_t*& in, const uint8_t* end, size_t& length) {
+    uint8_t byte;
+    do {
+        if (in == end) {
+            return false;
+        }
+        byte = *in++;
+        length += byte;
+    } while (byte == 255);
+
+    return true;
+}
+
+} // namespace
+
+std::string compressCacheBytes(std::string_view input) {
+    const auto* src = reinterpret_cast<const uint8_t*>(input.data());
+    const size_t size = input.size();
+
+    std::string out;
+    out.reserve(size / 2 + 16);
+
+    size_t anchor = 0;
+    if (size > kMinMatch + kLastLiterals) {
+        std::vector<uint32_t> table(size_t(1) << kHashBits, UINT32_MAX);
+        const size_t limit = size - kLastLiterals;
+        size_t pos = 0;
+
+        while (pos + kMinMatch <= limit) {
+            uint32_t sequence = read32(src + pos);
+            size_t hash = (sequence * 2654435761u) >> (32 - kHashBits);
+            uint32_t candidate = table[hash];
+            table[hash] = static_cast<uint32_t>(pos);
+
+            if (candidate == UINT32_MAX || pos - candidate > kMaxOffset || read32(src + candidate) != sequence) {
+                pos++;
+                continue;
+            }
+
+            // Eşleşmeyi sona değişmezler kalacak şekilde uzat
+            size_t length = kMinMatch;
+            while (pos + length < limit && src[candidate + length] == src[pos + length]) {
+                length++;
+            }
+
+            writeSequence(out, src + anchor, pos - anchor, pos - candidate, length);
+            pos += length;
+            anchor = pos;
+        }
+    }
+
+    // Kalan baytları değişmez olarak yaz
+    writeSequence(out, src + anchor, size - anchor, 0, 0);
+
+    return out;
+}
+
+bool decompressCacheBytes(std::string_view input, size_t outputSize, std::string& output) {
+    const auto* in = reinterpret_cast<const uint8_t*>(input.data());
+    const auto* end = in + input.size();
+
+    output.resize(outputSize);
+    auto* dst = reinterpret_cast<uint8_t*>(&output[0]);
+    size_t written = 0;
+
+    while (in < end) {
+        uint8_t token = *in++;
+
+        // Değişmez baytları kopyala
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && !readLength(in, end, literalLength)) {
+            return false;
+        }
+        if (literalLength > static_cast<size_t>(end - in) || literalLength > outputSize - written) {
+            return false;
+        }
+        std::memcpy(dst + written, in, literalLength);
+        in += literalLength;
+        written += literalLength;
+
+        if (in == end) {
+            break;
+        }
+
+        // Eşleşmeyi kopyala; kaynak ve hedef örtüşebilir
+        if (end - in < 2) {
+            return false;
+        }
+        size_t offset = in[0] | (static_cast<size_t>(in[1]) << 8);
+        in += 2;
+
+        size_t matchLength = token & 0x0F;
+        if (matchLength == 15 && !readLength(in, end, matchLength)) {
+            return false;
+        }
+        matchLength += kMinMatch;
+
+        if (offset == 0 || offset > written || matchLength > outputSize - written) {
+            return false;
+        }
+        if (offset >= matchLength) {
+            std::memcpy(dst + written, dst + written - offset, matchLength);
+        } else {
+            for (size_t i = 0; i < matchLength; i++) {
+                dst[written + i] = dst[written - offset + i];
+            }
+        }
+        written += matchLength;
+    }
+
+    return written == outputSize;
+}
+
+std::string CompressedCacheValue::decompress() const {
+    std::string encoded;
+    if (!decompressCacheBytes(bytes, encodedSize, encoded)) {
+        throw std::runtime_error("corrupt compressed cache value");
+    }
+
+    return encoded;
+}
+
+std::any CompressedCacheValue::value() const {
+    return codec->decode(decompress());
+}
+
+} // namespace data
+} // namespace alt_las
@@ -0,0 +1,142 @@
+#include "data/cache_eviction.h"
+
+namespace alt_las {
+namespace data {
+
+EvictionList::EvictionList(EvictionPolicy policy)
+    : hand_(nullptr),
+      policy_(policy),
+      size_(0) {
+
+    // Boş halka oluştur
+    head_.prev = &head_;
+    head_.next = &head_;
+}
+
+EvictionPolicy EvictionList::getPolicy() const {
+    return policy_;
+}
+
+void EvictionList::setPolicy(EvictionPolicy policy) {
+    policy_ = policy;
+}
+
+void EvictionList::insert(EvictionHook* hook) {
+    hook->referenced = false;
+
+    // CLOCK'ta yeni girdi ibrenin arkasına, diğerlerinde listenin sonuna eklenir
+    if (policy_ == EvictionPolicy::CLOCK && hand_ != nullptr) {
+        linkBefore(hook, hand_);
+    } else {
+        linkBefore(hook, &head_);
+    }
+
+    if (hand_ == nullptr) {
+        hand_ = hook;
+    }
+}
+
+void EvictionList::erase(EvictionHook* hook) {
+    // İbre silinen girdiyi gösteriyorsa ilerlet
+    if (hand_ == hook) {
+        advanceHand();
+        if (hand_ == hook) {
+            hand_ = nullptr;
+        }
+    }
+
+    unlink(hook);
+}
+
+void EvictionList::touch(EvictionHook* hook) {
+    switch (policy_) {
+        case EvictionPolicy::LRU:
+            // En yeni konuma taşı
+            if (hook->next != &head_) {
+                if (hand_ == hook) {
+                    advanceHand();
+                }
+                unlink(hook);
+                linkBefore(hook, &head_);
+            }
+            break;
+        case EvictionPolicy::CLOCK:
+            // Referans bitini işaretle
+            hook->referenced = true;
+            break;
+        case EvictionPolicy::FIFO:
+        default:
+            break;
+    }
+}
+
+EvictionHook* EvictionList::victim() {
+    if (size_ == 0) {
+        return nullptr;
+    }
+
+    if (policy_ != EvictionPolicy::CLOCK) {
+        return head_.next;
+    }
+
+    // Referans biti işaretli girdilere ikinci şans ver
+    if (hand_ == nullptr) {
+        hand_ = head_.next;
+    }
+
+    while (hand_->referenced) {
+        hand_->referenced = false;
+        advanceHand();
+    }
+
+    return hand_;
+}
+
+EvictionHook* EvictionList::front() const {
+    return size_ == 0 ? nullptr : head_.next;
+}
+
+EvictionHook* EvictionList::next(const EvictionHook* hook) const {
+    return hook->next == &head_ ? nullptr : hook->next;
+}
+
+void EvictionList::clear() {
+    head_.prev = &head_;
+    head_.next = &head_;
+    hand_ = nullptr;
+    size_ = 0;
+}
+
+size_t EvictionList::size() const {
+    return size_;
+}
+
+void EvictionList::linkBefore(EvictionHook* hook, EvictionHook* position) {
+    hook->prev = position->prev;
+    hook->next = position;
+    position->prev->next = hook;
+    position->prev = hook;
+    size_++;
+}
+
+void EvictionList::unlink(EvictionHook* hook) {
+    hook->prev->next = hook->next;
+    hook->next->prev = hook->prev;
+    hook->prev = nullptr;
+    hook->next = nullptr;
+    size_--;
+}
+
+void EvictionList::advanceHand() {
+    // Gözcü düğümü atlayarak halkada ilerle
+    hand_ = hand_->next;
+    if (hand_ == &head_) {
+        hand_ = head_.next;
+    }
+    if (hand_ == &head_) {
+        hand_ = nullptr;
+    }
+}
+
+} // namespace data
+} // namespace alt_las
@@ -0,0 +1,177 @@
+#include "data/cache_listener.h"
+#include "data/cache_compression.h"
+#include <iostream>
+#include <algorithm>
+
+namespace alt_las {
+namespace data {
+
+const char* getCacheRemovalReasonName(CacheRemovalReason reason) {
+    switch (reason) {
+        case CacheRemovalReason::EVICTED:
+            return "evicted";
+        case CacheRemovalReason::EXPIRED:
+            return "expired";
+        case CacheRemovalReason::REMOVED:
+            return "removed";
+        case CacheRemovalReason::REPLACED:
+            return "replaced";
+        case CacheRemovalReason::CLEARED:
+            return "cleared";
+    }
+
+    return "unknown";
+}
+
+CacheEventDispatcher::CacheEventDispatcher(size_t queueCapacity)
+    : listeners_(std::make_shared<const ListenerList>()),
+      hasListeners_(false),
+      nextListenerId_(1),
+      queueCapacity_(queueCapacity),
+      inFlight_(0),
+      running_(false),
+      stopping_(false) {
+}
+
+CacheEventDispatcher::~CacheEventDispatcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    condition_.notify_all();
+
+    // Bekleyen olaylar iletildikten sonra iş parçacığı çıkar
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+size_t CacheEventDispatcher::addListener(CacheRemovalListener listener) {
+    std::lock_guard<std::mutex> lock(listenersMutex_);
+
+    auto listeners = std::make_shared<ListenerList>(*std::atomic_load(&listeners_));
+    size_t id = nextListenerId_++;
+    listeners->emplace_back(id, std::move(listener));
+
+    std::atomic_store(&listeners_, std::shared_ptr<const ListenerList>(std::move(listeners)));
+    hasListeners_ = true;
+
+    return id;
+}
+
+bool CacheEventDispatcher::removeListener(size_t id) {
+    std::lock_guard<std::mutex> lock(listenersMutex_);
+
+    auto listeners = std::make_shared<ListenerList>(*std::atomic_load(&listeners_));
+    auto it = std::find_if(listeners->begin(), listeners->end(), [id](const auto& pair) {
+        return pair.first == id;
+    });
+    if (it == listeners->end()) {
+        return false;
+    }
+
+    listeners->erase(it);
+    hasListeners_ = !listeners->empty();
+    std::atomic_store(&listeners_, std::shared_ptr<const ListenerList>(std::move(listeners)));
+
+    return true;
+}
+
+bool CacheEventDispatcher::post(CacheRemovalEvent event) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // Kuyruk doluysa veya durduruluyorsa olayı düşür
+        if (stopping_ || queue_.size() >= queueCapacity_) {
+            return false;
+        }
+
+        queue_.push_back(std::move(event));
+
+        // İletim iş parçacığını ilk olayla başlat
+        if (!running_) {
+            running_ = true;
+            thread_ = std::thread(&CacheEventDispatcher::run, this);
+        }
+    }
+
+    condition_.notify_one();
+
+    return true;
+}
+
+void CacheEventDispatcher::flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this]() {
+        return queue_.empty() && inFlight_ == 0;
+    });
+}
+
+size_t CacheEventDispatcher::pending() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size();
+}
+
+size_t CacheEventDispatcher::getQueueCapacity() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queueCapacity_;
+}
+
+void CacheEventDispatcher::setQueueCapacity(size_t queueCapacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queueCapacity_ = queueCapacity;
+}
+
+void CacheEventDispatcher::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true) {
+        condition_.wait(lock, [this]() {
+            return stopping_ || !queue_.empty();
+        });
+
+        if (queue_.empty()) {
+            break;
+        }
+
+        // Olayları toplu al ve kilit dışında ilet
+        std::deque<CacheRemovalEvent> batch;
+        batch.swap(queue_);
+        inFlight_ = batch.size();
+        lock.unlock();
+
+        for (auto& event : batch) {
+            // Sıkıştırılmış değeri önbellek kilidi dışında aç
+            if (const auto* compressed = std::any_cast<CompressedCacheValue>(&event.value)) {
+                try {
+                    event.value = compressed->value();
+                } catch (const std::exception& e) {
+                    std::cerr << "Failed to decompress cache entry " << event.key << ": " << e.what() << std::endl;
+                }
+            }
+
+            auto listeners = std::atomic_load(&listeners_);
+            for (const auto& pair : *listeners) {
+                try {
+                    pair.second(event);
+                } catch (const std::exception& e) {
+                    std::cerr << "Failed to run cache removal listener for " << event.key << ": " << e.what() << std::endl;
+                } catch (...) {
+                    std::cerr << "Failed to run cache removal listener for " << event.key << ": unknown error" << std::endl;
+                }
+            }
+        }
+        batch.clear();
+
+        lock.lock();
+        inFlight_ = 0;
+        if (queue_.empty()) {
+            idle_.notify_all();
+        }
+    }
+
+    idle_.notify_all();
+}
+
+} // namespace data
+} // namespace alt_las
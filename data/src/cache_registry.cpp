@@ -0,0 +1,89 @@
+#include "data/cache_registry.h"
+
+namespace alt_las {
+namespace data {
+
+CacheRegistry& CacheRegistry::getInstance() {
+    static CacheRegistry instance;
+    return instance;
+}
+
+CacheRegistry::CacheRegistry() {
+    // Örnekler yok edilirken kullandıkları singleton'lar hâlâ yaşıyor olsun diye önce başlatılır
+    MaintenanceScheduler::getInstance();
+    CoarseClock::start();
+}
+
+std::shared_ptr<DataCache> CacheRegistry::create(const std::string& name, const CacheConfig& config) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (caches_.find(name) != caches_.end()) {
+        return nullptr;
+    }
+
+    std::shared_ptr<DataCache> cache(new DataCache(config));
+    caches_.emplace(name, cache);
+
+    return cache;
+}
+
+std::shared_ptr<DataCache> CacheRegistry::getOrCreate(const std::string& name, const CacheConfig& config) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = caches_.find(name);
+    if (it != caches_.end()) {
+        return it->second;
+    }
+
+    std::shared_ptr<DataCache> cache(new DataCache(config));
+    caches_.emplace(name, cache);
+
+    return cache;
+}
+
+std::shared_ptr<DataCache> CacheRegistry::get(const std::string& name) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = caches_.find(name);
+    return it == caches_.end() ? nullptr : it->second;
+}
+
+bool CacheRegistry::remove(const std::string& name) {
+    std::shared_ptr<DataCache> cache;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        auto it = caches_.find(name);
+        if (it == caches_.end()) {
+            return false;
+        }
+
+        cache = std::move(it->second);
+        caches_.erase(it);
+    }
+
+    // Son referanssa önbellek kilit dışında yok edilir
+    cache.reset();
+
+    return true;
+}
+
+std::vector<std::string> CacheRegistry::getNames() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::vector<std::string> names;
+    names.reserve(caches_.size());
+    for (const auto& pair : caches_) {
+        names.push_back(pair.first);
+    }
+
+    return names;
+}
+
+size_t CacheRegistry::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return caches_.size();
+}
+
+} // namespace data
+} // namespace alt_las
@@ -0,0 +1,478 @@
+#include "data/cache_shared.h"
+#include "data/cache_tags.h"
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <algorithm>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ALT_LAS_SHARED_SEGMENT 1
+#endif
+
+namespace alt_las {
+namespace data {
+
+namespace {
+
+constexpr uint32_t kSlotEmpty = 0;      // Boş yuva
+constexpr uint32_t kSlotUsed = 1;       // Dolu yuva
+constexpr uint32_t kSlotRemoved = 2;    // Silinmiş yuva
+constexpr int kOpenRetries = 100;       // Segmentin hazırlanmasını bekleme denemesi (10 ms)
+constexpr int kReadRetries = 64;        // Yazılan yuvayı yeniden okuma denemesi
+
+/**
+ * @brief Diller arası aynı sonucu veren 64 bit FNV-1a karması
+ */
+uint64_t hashKey(std::string_view key) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : key) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+size_t roundUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+std::string normalizeName(const std::string& name) {
+    return !name.empty() && name[0] == '/' ? name : "/" + name;
+}
+
+} // namespace
+
+struct CacheSharedSegment::Header {
+    char magic[4];                      // "ALSM"
+    uint32_t version;                   // Sürüm
+    uint64_t slotCount;                 // Yuva sayısı
+    uint64_t slotSize;                  // Yuva veri boyutu
+    uint64_t slotOffset;                // İlk yuvanın konumu
+    std::atomic<uint64_t> used;         // Dolu yuva sayısı
+    std::atomic<uint32_t> ready;        // Başlık hazır mı?
+#ifdef ALT_LAS_SHARED_SEGMENT
+    pthread_mutex_t mutex;              // Yazma mutex'i (süreçler arası, robust)
+#endif
+};
+
+struct CacheSharedSegment::Slot {
+    std::atomic<uint32_t> sequence;     // Sıra sayacı, yazılırken tek
+    std::atomic<uint32_t> state;        // Durum
+    std::atomic<uint64_t> hash;         // Anahtarın karması
+    std::atomic<int64_t> expiresAtMs;   // Sona erme zamanı, -1 ise süresiz
+    std::atomic<uint32_t> length;       // Kayıt uzunluğu
+    uint32_t reserved;                  // Boşluk
+
+    char* data() {
+        return reinterpret_cast<char*>(this + 1);
+    }
+
+    const char* data() const {
+        return reinterpret_cast<const char*>(this + 1);
+    }
+};
+
+static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t) && std::atomic<uint64_t>::is_always_lock_free,
+              "shared segment requires address-free 64-bit atomics");
+
+CacheSharedSegment::CacheSharedSegment(const std::string& name, size_t slotCount, size_t slotSize)
+    : name_(normalizeName(name)),
+      address_(nullptr),
+      mappedSize_(0),
+      header_(nullptr),
+      slotStride_(0) {
+
+#ifdef ALT_LAS_SHARED_SEGMENT
+    // Segmenti oluşturmayı dene, varsa aç
+    bool creator = true;
+    int fd = ::shm_open(name_.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0 && errno == EEXIST) {
+        creator = false;
+        fd = ::shm_open(name_.c_str(), O_RDWR, 0600);
+    }
+    if (fd < 0) {
+        return;
+    }
+
+    size_t count = 1;
+    while (count < slotCount) {
+        count <<= 1;
+    }
+    size_t offset = roundUp(sizeof(Header), 64);
+    size_t stride = roundUp(sizeof(Slot) + std::max<size_t>(slotSize, 64), 64);
+    size_t size = offset + count * stride;
+
+    if (creator) {
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+            ::close(fd);
+            ::shm_unlink(name_.c_str());
+            return;
+        }
+    } else {
+        // Oluşturan sürecin boyutu ayarlamasını bekle
+        size = 0;
+        for (int i = 0; i < kOpenRetries && size == 0; i++) {
+            struct stat info;
+            if (::fstat(fd, &info) == 0 && static_cast<size_t>(info.st_size) >= offset) {
+                size = static_cast<size_t>(info.st_size);
+            } else {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        }
+    }
+
+    void* address = size == 0 ? MAP_FAILED : ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (address == MAP_FAILED) {
+        if (creator) {
+            ::shm_unlink(name_.c_str());
+        }
+        return;
+    }
+
+    address_ = address;
+    mappedSize_ = size;
+    Header* header = static_cast<Header*>(address);
+
+    if (creator) {
+        // Başlığı hazırla; yuvalar ftruncate ile sıfırlanmıştır
+        new (header) Header();
+        std::memcpy(header->magic, kCacheSharedMagic, sizeof(kCacheSharedMagic));
+        header->version = kCacheSharedVersion;
+        header->slotCount = count;
+        header->slotSize = stride - sizeof(Slot);
+        header->slotOffset = offset;
+
+        pthread_mutexattr_t attributes;
+        ::pthread_mutexattr_init(&attributes);
+        ::pthread_mutexattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+        ::pthread_mutexattr_setrobust(&attributes, PTHREAD_MUTEX_ROBUST);
+        ::pthread_mutex_init(&header->mutex, &attributes);
+        ::pthread_mutexattr_destroy(&attributes);
+
+        header->ready.store(1, std::memory_order_release);
+    } else {
+        // Oluşturan sürecin başlığı hazırlamasını bekle
+        for (int i = 0; i < kOpenRetries && header->ready.load(std::memory_order_acquire) != 1; i++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        bool valid = header->ready.load(std::memory_order_acquire) == 1 &&
+                     std::memcmp(header->magic, kCacheSharedMagic, sizeof(kCacheSharedMagic)) == 0 &&
+                     header->version == kCacheSharedVersion &&
+                     header->slotOffset + header->slotCount * (sizeof(Slot) + header->slotSize) <= size;
+        if (!valid) {
+            ::munmap(address_, mappedSize_);
+            address_ = nullptr;
+            mappedSize_ = 0;
+            return;
+        }
+    }
+
+    header_ = header;
+    slotStride_ = sizeof(Slot) + header->slotSize;
+#else
+    (void)slotCount;
+    (void)slotSize;
+#endif
+}
+
+CacheSharedSegment::~CacheSharedSegment() {
+#ifdef ALT_LAS_SHARED_SEGMENT
+    if (address_ != nullptr) {
+        ::munmap(address_, mappedSize_);
+    }
+#endif
+}
+
+bool CacheSharedSegment::isOpen() const {
+    return header_ != nullptr;
+}
+
+bool CacheSharedSegment::put(const CacheSnapshotRecord& record, int64_t nowMs) {
+    std::string bytes;
+    encodeCacheSnapshotRecord(record, bytes);
+    return put(record.key, record.expiresAtMs, bytes, nowMs);
+}
+
+bool CacheSharedSegment::put(std::string_view key, int64_t expiresAtMs, std::string_view bytes, int64_t nowMs) {
+    if (header_ == nullptr || bytes.size() > header_->slotSize) {
+        return false;
+    }
+
+    uint64_t hash = hashKey(key);
+    if (!lock()) {
+        return false;
+    }
+
+    // Aynı anahtarı zincir sonuna kadar ara, ilk yeniden kullanılabilir yuvayı hatırla
+    size_t mask = header_->slotCount - 1;
+    Slot* target = nullptr;
+    for (size_t probe = 0; probe < header_->slotCount; probe++) {
+        Slot* slot = slotAt((hash + probe) & mask);
+        uint32_t state = slot->state.load(std::memory_order_relaxed);
+
+        if (state == kSlotEmpty) {
+            if (target == nullptr) {
+                target = slot;
+            }
+            break;
+        }
+
+        if (state == kSlotUsed && hasKey(slot, hash, key)) {
+            target = slot;
+            break;
+        }
+
+        int64_t slotExpiresAtMs = slot->expiresAtMs.load(std::memory_order_relaxed);
+        if (target == nullptr && (state == kSlotRemoved || (slotExpiresAtMs >= 0 && slotExpiresAtMs <= nowMs))) {
+            target = slot;
+        }
+    }
+
+    if (target != nullptr) {
+        if (target->state.load(std::memory_order_relaxed) != kSlotUsed) {
+            header_->used.fetch_add(1, std::memory_order_relaxed);
+        }
+        writeSlot(target, kSlotUsed, hash, expiresAtMs, bytes);
+    }
+
+    unlock();
+
+    return target != nullptr;
+}
+
+bool CacheSharedSegment::get(std::string_view key, int64_t nowMs, std::string& buffer, CacheSnapshotRecord& record) const {
+    if (header_ == nullptr) {
+        return false;
+    }
+
+    uint64_t hash = hashKey(key);
+    size_t mask = header_->slotCount - 1;
+
+    for (size_t probe = 0; probe < header_->slotCount; probe++) {
+        const Slot* slot = slotAt((hash + probe) & mask);
+        uint32_t state = kSlotEmpty;
+        uint64_t slotHash = 0;
+        int64_t expiresAtMs = -1;
+        bool consistent = false;
+
+        // Yuvayı kilitsiz kopyala; sayaç değiştiyse yazma araya girmiştir
+        for (int attempt = 0; attempt < kReadRetries && !consistent; attempt++) {
+            uint32_t before = slot->sequence.load(std::memory_order_acquire);
+            if (before & 1) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            state = slot->state.load(std::memory_order_relaxed);
+            slotHash = slot->hash.load(std::memory_order_relaxed);
+            expiresAtMs = slot->expiresAtMs.load(std::memory_order_relaxed);
+            uint32_t length = slot->length.load(std::memory_order_relaxed);
+            if (state == kSlotUsed && slotHash == hash && length <= header_->slotSize) {
+                buffer.assign(slot->data(), length);
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            consistent = slot->sequence.load(std::memory_order_relaxed) == before;
+        }
+
+        if (!consistent || state == kSlotEmpty) {
+            return false;
+        }
+
+        if (state != kSlotUsed || slotHash != hash) {
+            continue;
+        }
+
+        size_t offset = 0;
+        if (!decodeCacheSnapshotRecord(buffer, offset, record) || record.key != key) {
+            continue;
+        }
+
+        return expiresAtMs < 0 || expiresAtMs > nowMs;
+    }
+
+    return false;
+}
+
+bool CacheSharedSegment::remove(std::string_view key) {
+    if (header_ == nullptr || !lock()) {
+        return false;
+    }
+
+    uint64_t hash = hashKey(key);
+    size_t mask = header_->slotCount - 1;
+    bool removed = false;
+
+    for (size_t probe = 0; probe < header_->slotCount; probe++) {
+        Slot* slot = slotAt((hash + probe) & mask);
+        uint32_t state = slot->state.load(std::memory_order_relaxed);
+        if (state == kSlotEmpty) {
+            break;
+        }
+
+        // Zincir kopmasın diye yuva boşaltılmaz, silinmiş olarak işaretlenir
+        if (state == kSlotUsed && hasKey(slot, hash, key)) {
+            writeSlot(slot, kSlotRemoved, 0, -1, std::string_view());
+            header_->used.fetch_sub(1, std::memory_order_relaxed);
+            removed = true;
+            break;
+        }
+    }
+
+    unlock();
+
+    return removed;
+}
+
+size_t CacheSharedSegment::removeByTags(const std::vector<std::string>& tags) {
+    if (header_ == nullptr || tags.empty() || !lock()) {
+        return 0;
+    }
+
+    size_t count = 0;
+
+    // Tüm etiketleri taşıyan kayıtları silinmiş olarak işaretle
+    for (size_t i = 0; i < header_->slotCount; i++) {
+        Slot* slot = slotAt(i);
+        if (slot->state.load(std::memory_order_relaxed) != kSlotUsed) {
+            continue;
+        }
+
+        CacheSnapshotRecord record;
+        size_t offset = 0;
+        std::string_view bytes(slot->data(), slot->length.load(std::memory_order_relaxed));
+        if (!decodeCacheSnapshotRecord(bytes, offset, record)) {
+            continue;
+        }
+
+        std::vector<std::string> recordTags = parseCacheTags(std::string(record.tags));
+        if (std::includes(recordTags.begin(), recordTags.end(), tags.begin(), tags.end())) {
+            writeSlot(slot, kSlotRemoved, 0, -1, std::string_view());
+            header_->used.fetch_sub(1, std::memory_order_relaxed);
+            count++;
+        }
+    }
+
+    unlock();
+
+    return count;
+}
+
+void CacheSharedSegment::clear() {
+    if (header_ == nullptr || !lock()) {
+        return;
+    }
+
+    for (size_t i = 0; i < header_->slotCount; i++) {
+        Slot* slot = slotAt(i);
+        if (slot->state.load(std::memory_order_relaxed) != kSlotEmpty) {
+            writeSlot(slot, kSlotEmpty, 0, -1, std::string_view());
+        }
+    }
+    header_->used.store(0, std::memory_order_relaxed);
+
+    unlock();
+}
+
+size_t CacheSharedSegment::size() const {
+    return header_ == nullptr ? 0 : static_cast<size_t>(header_->used.load(std::memory_order_relaxed));
+}
+
+size_t CacheSharedSegment::slotCount() const {
+    return header_ == nullptr ? 0 : static_cast<size_t>(header_->slotCount);
+}
+
+size_t CacheSharedSegment::slotSize() const {
+    return header_ == nullptr ? 0 : static_cast<size_t>(header_->slotSize);
+}
+
+bool CacheSharedSegment::unlink(const std::string& name) {
+#ifdef ALT_LAS_SHARED_SEGMENT
+    return ::shm_unlink(normalizeName(name).c_str()) == 0;
+#else
+    (void)name;
+    return false;
+#endif
+}
+
+bool CacheSharedSegment::lock() {
+#ifdef ALT_LAS_SHARED_SEGMENT
+    int result = ::pthread_mutex_lock(&header_->mutex);
+    if (result != EOWNERDEAD) {
+        return result == 0;
+    }
+
+    // Kilit sahibi yazarken öldü; yarım kalan yuvalar silinmiş sayılır
+    uint64_t used = 0;
+    for (size_t i = 0; i < header_->slotCount; i++) {
+        Slot* slot = slotAt(i);
+        uint32_t sequence = slot->sequence.load(std::memory_order_relaxed);
+        if (sequence & 1) {
+            slot->state.store(kSlotRemoved, std::memory_order_relaxed);
+            slot->sequence.store(sequence + 1, std::memory_order_release);
+        }
+        if (slot->state.load(std::memory_order_relaxed) == kSlotUsed) {
+            used++;
+        }
+    }
+    header_->used.store(used, std::memory_order_relaxed);
+
+    ::pthread_mutex_consistent(&header_->mutex);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void CacheSharedSegment::unlock() {
+#ifdef ALT_LAS_SHARED_SEGMENT
+    ::pthread_mutex_unlock(&header_->mutex);
+#endif
+}
+
+CacheSharedSegment::Slot* CacheSharedSegment::slotAt(size_t index) const {
+    return reinterpret_cast<Slot*>(static_cast<char*>(address_) + header_->slotOffset + index * slotStride_);
+}
+
+bool CacheSharedSegment::hasKey(const Slot* slot, uint64_t hash, std::string_view key) const {
+    if (slot->hash.load(std::memory_order_relaxed) != hash) {
+        return false;
+    }
+
+    CacheSnapshotRecord record;
+    size_t offset = 0;
+    std::string_view bytes(slot->data(), slot->length.load(std::memory_order_relaxed));
+
+    return decodeCacheSnapshotRecord(bytes, offset, record) && record.key == key;
+}
+
+void CacheSharedSegment::writeSlot(Slot* slot, uint32_t state, uint64_t hash, int64_t expiresAtMs, std::string_view bytes) {
+    // Sayaç tekken okuyucular yuvayı yeniden okur
+    uint32_t sequence = slot->sequence.load(std::memory_order_relaxed);
+    slot->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot->state.store(state, std::memory_order_relaxed);
+    slot->hash.store(hash, std::memory_order_relaxed);
+    slot->expiresAtMs.store(expiresAtMs, std::memory_order_relaxed);
+    slot->length.store(static_cast<uint32_t>(bytes.size()), std::memory_order_relaxed);
+    if (!bytes.empty()) {
+        std::memcpy(slot->data(), bytes.data(), bytes.size());
+    }
+
+    slot->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+} // namespace data
+} // namespace alt_las
@@ -0,0 +1,193 @@
+#include "data/cache_snapshot.h"
+#include <cstdio>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ALT_LAS_SNAPSHOT_MMAP 1
+#endif
+
+namespace alt_las {
+namespace data {
+
+namespace {
+
+template <typename Number>
+void appendNumber(std::string& out, Number value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void appendField(std::string& out, std::string_view value) {
+    appendNumber(out, static_cast<uint32_t>(value.size()));
+    out.append(value.data(), value.size());
+}
+
+template <typename Number>
+bool readNumber(std::string_view data, size_t& offset, Number& value) {
+    if (data.size() - offset < sizeof(value)) {
+        return false;
+    }
+
+    std::memcpy(&value, data.data() + offset, sizeof(value));
+    offset += sizeof(value);
+
+    return true;
+}
+
+bool readField(std::string_view data, size_t& offset, std::string_view& value) {
+    uint32_t length = 0;
+    if (!readNumber(data, offset, length) || data.size() - offset < length) {
+        return false;
+    }
+
+    value = data.substr(offset, length);
+    offset += length;
+
+    return true;
+}
+
+} // namespace
+
+void encodeCacheSnapshotRecord(const CacheSnapshotRecord& record, std::string& out) {
+    appendField(out, record.key);
+    appendField(out, record.type);
+    appendField(out, record.tags);
+    appendNumber(out, record.ttlSeconds);
+    appendNumber(out, record.expiresAtMs);
+    appendNumber(out, record.staleAtMs);
+    appendField(out, record.payload);
+}
+
+bool decodeCacheSnapshotRecord(std::string_view data, size_t& offset, CacheSnapshotRecord& record) {
+    size_t position = offset;
+
+    if (readField(data, position, record.key) &&
+        readField(data, position, record.type) &&
+        readField(data, position, record.tags) &&
+        readNumber(data, position, record.ttlSeconds) &&
+        readNumber(data, position, record.expiresAtMs) &&
+        readNumber(data, position, record.staleAtMs) &&
+        readField(data, position, record.payload)) {
+        offset = position;
+        return true;
+    }
+
+    return false;
+}
+
+CacheSnapshotWriter::CacheSnapshotWriter(const std::string& path)
+    : path_(path),
+      tempPath_(path + ".tmp"),
+      file_(tempPath_, std::ios::binary | std::ios::trunc) {
+
+    // Başlığı yaz
+    if (file_) {
+        buffer_.append(kCacheSnapshotMagic, sizeof(kCacheSnapshotMagic));
+        appendNumber(buffer_, kCacheSnapshotVersion);
+        file_.write(buffer_.data(), buffer_.size());
+    }
+}
+
+bool CacheSnapshotWriter::isOpen() const {
+    return static_cast<bool>(file_);
+}
+
+void CacheSnapshotWriter::write(const CacheSnapshotRecord& record) {
+    buffer_.clear();
+    encodeCacheSnapshotRecord(record, buffer_);
+    file_.write(buffer_.data(), buffer_.size());
+}
+
+bool CacheSnapshotWriter::commit() {
+    file_.close();
+    if (!file_) {
+        std::remove(tempPath_.c_str());
+        return false;
+    }
+
+    // Eski dosyanın yerine taşı; okuyucular yarım dosya görmez
+    return std::rename(tempPath_.c_str(), path_.c_str()) == 0;
+}
+
+CacheSnapshotReader::CacheSnapshotReader(const std::string& path)
+    : data_(nullptr),
+      size_(0),
+      offset_(0),
+      mapped_(false),
+      open_(false) {
+
+#ifdef ALT_LAS_SNAPSHOT_MMAP
+    // Dosyayı belleğe eşle
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat info;
+        if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+            void* address = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (address != MAP_FAILED) {
+                data_ = static_cast<const char*>(address);
+                size_ = static_cast<size_t>(info.st_size);
+                mapped_ = true;
+            }
+        }
+        ::close(fd);
+    }
+#endif
+
+    // Eşleme yapılamadıysa dosyayı belleğe oku
+    if (!mapped_) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            return;
+        }
+
+        buffer_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+    }
+
+    // Başlığı kontrol et
+    uint32_t version = 0;
+    if (size_ < sizeof(kCacheSnapshotMagic) || std::memcmp(data_, kCacheSnapshotMagic, sizeof(kCacheSnapshotMagic)) != 0) {
+        return;
+    }
+
+    offset_ = sizeof(kCacheSnapshotMagic);
+    open_ = readNumber(std::string_view(data_, size_), offset_, version) && version == kCacheSnapshotVersion;
+}
+
+CacheSnapshotReader::~CacheSnapshotReader() {
+#ifdef ALT_LAS_SNAPSHOT_MMAP
+    if (mapped_) {
+        ::munmap(const_cast<char*>(data_), size_);
+    }
+#endif
+}
+
+bool CacheSnapshotReader::isOpen() const {
+    return open_;
+}
+
+bool CacheSnapshotReader::isMapped() const {
+    return mapped_;
+}
+
+bool CacheSnapshotReader::next(CacheSnapshotRecord& record) {
+    if (!open_) {
+        return false;
+    }
+
+    // Kayıt yarım kalmışsa dosyanın sonu sayılır
+    if (decodeCacheSnapshotRecord(std::string_view(data_, size_), offset_, record)) {
+        return true;
+    }
+
+    open_ = false;
+
+    return false;
+}
+
+} // namespace data
+} // namespace alt_las
@@ -0,0 +1,359 @@
+#include "data/cache_spill.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace alt_las {
+namespace data {
+
+CacheSpillStore::CacheSpillStore(const std::string& path, size_t byteBudget)
+    : path_(path),
+      file_(path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc),
+      filter_(new std::atomic<uint32_t>[kFilterSize]()),
+      byteBudget_(byteBudget),
+      liveBytes_(0),
+      fileSize_(0),
+      compactions_(0),
+      nextTicket_(1),
+      generation_(0),
+      compacting_(false),
+      compactionTask_(0),
+      scheduler_(MaintenanceScheduler::getInstance()) {
+}
+
+CacheSpillStore::~CacheSpillStore() {
+    // Bekleyen sıkıştırmayı iptal et, süren sıkıştırmanın bitmesini bekle
+    MaintenanceScheduler::TaskId task = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task = compacting_ ? compactionTask_ : 0;
+    }
+    if (task != 0) {
+        scheduler_.cancel(task);
+    }
+
+    // Segment dosyası süreç başına geçicidir
+    file_.close();
+    std::remove(path_.c_str());
+    std::remove((path_ + ".compact").c_str());
+}
+
+bool CacheSpillStore::isOpen() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return file_.is_open();
+}
+
+uint64_t CacheSpillStore::reserve(std::string_view key, int64_t expiresAtMs, const std::vector<std::string>& tags) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Eski kaydı ölü say
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        dropSlot(it);
+    }
+
+    auto slot = std::make_unique<Slot>();
+    slot->key = std::string(key);
+    slot->ticket = nextTicket_++;
+    slot->written = false;
+    slot->offset = 0;
+    slot->length = 0;
+    slot->expiresAtMs = expiresAtMs;
+    slot->tags = tags;
+
+    uint64_t ticket = slot->ticket;
+    std::string_view slotKey(slot->key);
+    index_.emplace(slotKey, std::move(slot));
+    filterCounter(slotKey).fetch_add(1, std::memory_order_release);
+
+    return ticket;
+}
+
+bool CacheSpillStore::write(std::string_view key, uint64_t ticket, const std::string& bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Yer bu arada silindiyse veya yeniden ayrıldıysa kayıt eskidir
+    auto it = index_.find(key);
+    if (it == index_.end() || it->second->ticket != ticket || it->second->written || !file_.is_open()) {
+        return false;
+    }
+
+    // Kaydı segmentin sonuna ekle
+    file_.seekp(static_cast<std::streamoff>(fileSize_));
+    file_.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    if (!file_) {
+        file_.clear();
+        dropSlot(it);
+        return false;
+    }
+
+    Slot& slot = *it->second;
+    slot.written = true;
+    slot.offset = fileSize_;
+    slot.length = static_cast<uint32_t>(bytes.size());
+    order_.emplace(fileSize_, it->first);
+    liveBytes_ += bytes.size();
+    fileSize_ += bytes.size();
+
+    checkBudget();
+
+    return true;
+}
+
+bool CacheSpillStore::take(std::string_view key, std::string& buffer, CacheSnapshotRecord& record) {
+    if (!mayContain(key)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = index_.find(key);
+    if (it == index_.end() || !it->second->written) {
+        return false;
+    }
+
+    // Kaydı oku
+    buffer.resize(it->second->length);
+    file_.seekg(static_cast<std::streamoff>(it->second->offset));
+    file_.read(&buffer[0], static_cast<std::streamsize>(buffer.size()));
+    bool success = static_cast<bool>(file_);
+    if (!success) {
+        file_.clear();
+    }
+
+    // Kayıt belleğe döndüğü için dizinden çıkar
+    dropSlot(it);
+    checkBudget();
+
+    size_t offset = 0;
+    return success && decodeCacheSnapshotRecord(buffer, offset, record);
+}
+
+bool CacheSpillStore::contains(std::string_view key, int64_t nowMs) const {
+    if (!mayContain(key)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = index_.find(key);
+    return it != index_.end() && it->second->written &&
+           (it->second->expiresAtMs < 0 || it->second->expiresAtMs > nowMs);
+}
+
+bool CacheSpillStore::remove(std::string_view key) {
+    if (!mayContain(key)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+        return false;
+    }
+
+    dropSlot(it);
+    checkBudget();
+
+    return true;
+}
+
+size_t CacheSpillStore::removeByTags(const std::vector<std::string>& tags) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t count = 0;
+
+    // Tüm etiketleri taşıyan kayıtları ve ayrılmış yerleri çıkar
+    for (auto it = index_.begin(); it != index_.end();) {
+        auto current = it++;
+        const auto& slotTags = current->second->tags;
+        if (std::includes(slotTags.begin(), slotTags.end(), tags.begin(), tags.end())) {
+            if (current->second->written) {
+                count++;
+            }
+            dropSlot(current);
+        }
+    }
+
+    checkBudget();
+
+    return count;
+}
+
+void CacheSpillStore::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    order_.clear();
+    index_.clear();
+    for (size_t i = 0; i < kFilterSize; i++) {
+        filter_[i].store(0, std::memory_order_relaxed);
+    }
+    liveBytes_ = 0;
+    fileSize_ = 0;
+
+    // Süren sıkıştırmanın sonucu yok sayılır
+    generation_++;
+
+    // Segmenti sıfırla
+    file_.close();
+    file_.open(path_, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+}
+
+size_t CacheSpillStore::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return order_.size();
+}
+
+size_t CacheSpillStore::bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return liveBytes_;
+}
+
+size_t CacheSpillStore::fileSize() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return fileSize_;
+}
+
+size_t CacheSpillStore::compactions() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return compactions_;
+}
+
+size_t CacheSpillStore::getByteBudget() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return byteBudget_;
+}
+
+void CacheSpillStore::setByteBudget(size_t byteBudget) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    byteBudget_ = byteBudget;
+    checkBudget();
+}
+
+std::atomic<uint32_t>& CacheSpillStore::filterCounter(std::string_view key) const {
+    return filter_[std::hash<std::string_view>()(key) & (kFilterSize - 1)];
+}
+
+bool CacheSpillStore::mayContain(std::string_view key) const {
+    return filterCounter(key).load(std::memory_order_acquire) != 0;
+}
+
+void CacheSpillStore::dropSlot(SlotMap::iterator it) {
+    if (it->second->written) {
+        order_.erase(it->second->offset);
+        liveBytes_ -= it->second->length;
+    }
+    filterCounter(it->first).fetch_sub(1, std::memory_order_release);
+    index_.erase(it);
+}
+
+void CacheSpillStore::checkBudget() {
+    // Bütçe aşıldıysa en eski kayıtları düşür
+    while (byteBudget_ > 0 && liveBytes_ > byteBudget_ && !order_.empty()) {
+        dropSlot(index_.find(order_.begin()->second));
+    }
+
+    // Ölü baytlar canlı baytları aştıysa segmenti iş havuzunda sıkıştır
+    if (!compacting_ && fileSize_ >= kMinCompactionBytes && fileSize_ - liveBytes_ > liveBytes_) {
+        compacting_ = true;
+        compactionTask_ = scheduler_.submit([this]() {
+            compact();
+        });
+    }
+}
+
+bool CacheSpillStore::compact() {
+    std::string tempPath = path_ + ".compact";
+    std::vector<std::pair<uint64_t, uint32_t>> live;
+    uint64_t copiedSize = 0;
+    uint64_t generation = 0;
+
+    // Kopyalanacak kayıtları belirle; bu konumlardaki baytlar bir daha değişmez
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        live.reserve(order_.size());
+        for (const auto& pair : order_) {
+            live.emplace_back(pair.first, index_.find(pair.second)->second->length);
+        }
+        copiedSize = fileSize_;
+        generation = generation_;
+        file_.flush();
+    }
+
+    // Canlı kayıtları kilit dışında, eski sırayla yeni segmente kopyala
+    std::ifstream in(path_, std::ios::binary);
+    std::fstream out(tempPath, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    std::unordered_map<uint64_t, uint64_t> moved;
+    std::string buffer;
+    uint64_t offset = 0;
+
+    moved.reserve(live.size());
+    for (const auto& pair : live) {
+        buffer.resize(pair.second);
+        in.seekg(static_cast<std::streamoff>(pair.first));
+        in.read(&buffer[0], static_cast<std::streamsize>(buffer.size()));
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+        moved.emplace(pair.first, offset);
+        offset += pair.second;
+    }
+    bool copied = in && out;
+    in.close();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    compacting_ = false;
+
+    // Segment bu arada sıfırlandıysa kopya geçersizdir
+    if (!copied || generation != generation_ || !file_.is_open()) {
+        out.close();
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    // Kopyalama sırasında eklenen kayıtları taşı
+    for (auto it = order_.lower_bound(copiedSize); it != order_.end(); ++it) {
+        Slot& slot = *index_.find(it->second)->second;
+
+        buffer.resize(slot.length);
+        file_.seekg(static_cast<std::streamoff>(slot.offset));
+        file_.read(&buffer[0], static_cast<std::streamsize>(buffer.size()));
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+        moved.emplace(slot.offset, offset);
+        offset += slot.length;
+    }
+
+    out.close();
+    if (!file_ || !out) {
+        file_.clear();
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    // Yeni segmenti eskisinin yerine taşı
+    file_.close();
+    bool renamed = std::rename(tempPath.c_str(), path_.c_str()) == 0;
+    file_.open(path_, std::ios::in | std::ios::out | std::ios::binary);
+    if (!renamed) {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    // Konumları güncelle; kopyalanıp bu arada silinen kayıtlar ölü bayt olarak kalır
+    std::map<uint64_t, std::string_view> order;
+    for (const auto& pair : order_) {
+        Slot& slot = *index_.find(pair.second)->second;
+        slot.offset = moved.at(pair.first);
+        order.emplace(slot.offset, pair.second);
+    }
+    order_.swap(order);
+
+    fileSize_ = offset;
+    compactions_++;
+
+    return true;
+}
+
+} // namespace data
+} // namespace alt_las
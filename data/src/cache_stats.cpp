@@ -0,0 +1,114 @@
+#include "data/cache_stats.h"
+
+namespace alt_las {
+namespace data {
+
+CacheStatCounters::CacheStatCounters() {
+    // Sayaçları sıfırla
+    reset();
+}
+
+size_t CacheStatCounters::get(CacheStat stat) const {
+    size_t total = 0;
+
+    // Şeritleri topla
+    for (size_t i = 0; i < kStripeCount; i++) {
+        total += stripes_[i].values[static_cast<size_t>(stat)].load(std::memory_order_relaxed);
+    }
+
+    return total;
+}
+
+void CacheStatCounters::reset() {
+    for (size_t i = 0; i < kStripeCount; i++) {
+        for (auto& value : stripes_[i].values) {
+            value.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+std::unordered_map<std::string, size_t> CacheStatCounters::snapshot() const {
+    std::unordered_map<std::string, size_t> stats;
+
+    for (size_t i = 0; i < static_cast<size_t>(CacheStat::COUNT); i++) {
+        CacheStat stat = static_cast<CacheStat>(i);
+        stats[getName(stat)] = get(stat);
+    }
+
+    return stats;
+}
+
+const char* CacheStatCounters::getName(CacheStat stat) {
+    switch (stat) {
+        case CacheStat::HIT:
+            return "hit";
+        case CacheStat::MISS:
+            return "miss";
+        case CacheStat::SET:
+            return "set";
+        case CacheStat::REMOVE:
+            return "remove";
+        case CacheStat::CLEAR:
+            return "clear";
+        case CacheStat::CLEAR_EXPIRED:
+            return "clearExpired";
+        case CacheStat::CLEAR_BY_TAGS:
+            return "clearByTags";
+        case CacheStat::EXPIRED:
+            return "expired";
+        case CacheStat::CAST_ERROR:
+            return "error";
+        case CacheStat::CAPACITY_EXCEEDED:
+            return "capacityExceeded";
+        case CacheStat::LOAD:
+            return "load";
+        case CacheStat::LOAD_SAVED:
+            return "loadSaved";
+        case CacheStat::STALE_HIT:
+            return "staleHit";
+        case CacheStat::REFRESH:
+            return "refresh";
+        case CacheStat::REFRESH_ERROR:
+            return "refreshError";
+        case CacheStat::SNAPSHOT_SAVED:
+            return "snapshotSaved";
+        case CacheStat::SNAPSHOT_LOADED:
+            return "snapshotLoaded";
+        case CacheStat::SPILL_WRITE:
+            return "spillWrite";
+        case CacheStat::SPILL_HIT:
+            return "spillHit";
+        case CacheStat::ADMISSION_REJECTED:
+            return "admissionRejected";
+        case CacheStat::LISTENER_DROPPED:
+            return "listenerDropped";
+        case CacheStat::FRONT_HIT:
+            return "frontHit";
+        case CacheStat::ENTRY_ALLOCATED:
+            return "entryAllocated";
+        case CacheStat::ENTRY_REUSED:
+            return "entryReused";
+        case CacheStat::COMPRESS:
+            return "compress";
+        case CacheStat::DECOMPRESS:
+            return "decompress";
+        case CacheStat::SHARED_WRITE:
+            return "sharedWrite";
+        case CacheStat::SHARED_HIT:
+            return "sharedHit";
+        default:
+            return "unknown";
+    }
+}
+
+size_t CacheStatCounters::stripeIndex() {
+    static std::atomic<size_t> nextStripe(0);
+
+    // Her iş parçacığı ilk kullanımda sıradaki şeride atanır
+    thread_local size_t index = nextStripe.fetch_add(1, std::memory_order_relaxed) % kStripeCount;
+
+    return index;
+}
+
+} // namespace data
+} // namespace alt_las
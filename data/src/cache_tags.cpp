@@ -0,0 +1,35 @@
+#include "data/cache_tags.h"
+#include <algorithm>
+
+namespace alt_las {
+namespace data {
+
+std::vector<std::string> parseCacheTags(const std::string& tags) {
+    std::vector<std::string> result;
+    std::string current;
+
+    // Ayırıcılara göre böl
+    for (char c : tags) {
+        if (c == ',' || c == ';' || c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+            if (!current.empty()) {
+                result.push_back(current);
+                current.clear();
+            }
+        } else {
+            current.push_back(c);
+        }
+    }
+
+    if (!current.empty()) {
+        result.push_back(current);
+    }
+
+    // Sırala ve tekrarları kaldır
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+
+    return result;
+}
+
+} // namespace data
+} // namespace alt_las
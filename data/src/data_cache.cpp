@@ -5,66 +5,191 @@
 namespace alt_las {
 namespace data {
 
+namespace {
+
+int64_t toEpochMillis(CoarseClock::time_point time) {
+    if (time == CoarseClock::time_point::max()) {
+        return -1;
+    }
+    
+    // Kayıtlar süreçler arası geçerli olsun diye duvar saatine dönüştürülür
+    return std::chrono::duration_cast<std::chrono::milliseconds>(CoarseClock::toSystem(time).time_since_epoch()).count();
+}
+
+CoarseClock::time_point fromEpochMillis(int64_t millis) {
+    if (millis < 0) {
+        return CoarseClock::time_point::max();
+    }
+    
+    return CoarseClock::fromSystem(std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::milliseconds(millis))));
+}
+
+std::string joinTags(const std::vector<std::string>& tags) {
+    std::string joined;
+    
+    for (const auto& tag : tags) {
+        if (!joined.empty()) {
+            joined.push_back(',');
+        }
+        joined.append(tag);
+    }
+    
+    return joined;
+}
+
+/**
+ * @brief İş parçacığı yerel ön önbellek yuvası
+ */
+struct FrontCacheSlot {
+    uint64_t cache = 0;                          // Örnek kimliği, boşsa 0
+    uint64_t epoch = 0;                          // Eklendiği andaki sürüm
+    size_t hash = 0;                             // Anahtarın karma değeri
+    const std::type_info* type = nullptr;        // Değer türü
+    CoarseClock::time_point expiresAt;           // Girdinin sona erme zamanı
+    std::string key;                             // Anahtar
+    std::shared_ptr<const void> value;           // Değer
+};
+
+std::atomic<uint64_t> nextInstanceId(1); // Sonraki örnek kimliği
+
+/**
+ * @brief Örnek ve anahtar için iş parçacığının ön önbellek yuvasını döndürür
+ */
+FrontCacheSlot& frontSlot(uint64_t cache, size_t hash) {
+    thread_local FrontCacheSlot slots[DataCache::kFrontCacheSlots];
+    
+    // Örnekler aynı anahtarlarda çakışmasın diye kimlik karmaya karıştırılır
+    size_t index = (hash ^ (cache * 0x9E3779B97F4A7C15ULL)) & (DataCache::kFrontCacheSlots - 1);
+    return slots[index];
+}
+
+} // namespace
+
 DataCache& DataCache::getInstance() {
     static DataCache instance;
     return instance;
 }
 
-DataCache::DataCache()
-    : capacity_(1000),
-      defaultTtl_(std::chrono::seconds(3600)),
-      cleanupInterval_(std::chrono::seconds(300)),
-      autoCleanupRunning_(false) {
+DataCache::DataCache(const CacheConfig& config)
+    : shards_(new CacheShard[kMaxShardCount]),
+      shardCount_(kDefaultShardCount),
+      capacity_(config.capacity),
+      memoryBudget_(config.memoryBudget),
+      evictionPolicy_(config.evictionPolicy),
+      admissionPolicy_(config.admissionPolicy),
+      defaultTtl_(config.defaultTtl),
+      cleanupInterval_(std::max(config.cleanupInterval, std::chrono::seconds(1))),
+      autoCleanupRunning_(false),
+      scheduler_(MaintenanceScheduler::getInstance()),
+      cleanupTask_(0),
+      snapshotTask_(0),
+      snapshotInterval_(std::chrono::seconds(0)),
+      warmupPending_(false),
+      warmupBaseHits_(0),
+      warmupBaseMisses_(0),
+      warmupMillis_(0),
+      snapshotLoadMicros_(0),
+      spillEnabled_(false),
+      sharedEnabled_(false),
+      removalDispatcher_(kDefaultListenerQueueCapacity),
+      instanceId_(nextInstanceId.fetch_add(1)),
+      frontCacheEnabled_(config.frontCache),
+      compressionThreshold_(config.compressionThreshold),
+      frontEpoch_(0) {
+    
+    // Saat iş parçacığı önbellekten sonra durdurulsun diye önce başlatılır
+    CoarseClock::start();
+    
+    // Parça sayısını 2'nin kuvvetine yuvarla
+    size_t shardCount = kDefaultShardCount;
+    while (shardCount < config.shardCount && shardCount < kMaxShardCount) {
+        shardCount <<= 1;
+    }
+    shardCount_ = shardCount;
+    
+    // Parçaların tahliye politikasını ayarla
+    for (size_t i = 0; i < kMaxShardCount; i++) {
+        shards_[i].eviction.setPolicy(config.evictionPolicy);
+    }
     
     // İstatistikleri sıfırla
     resetStats();
 }
 
 DataCache::~DataCache() {
-    // Otomatik temizlemeyi durdur
+    // Otomatik temizlemeyi ve diğer bakım görevlerini durdur
     stopAutoCleanup();
+    cancelMaintenance();
+    
+    // Anlık görüntü yolu ayarlandıysa önbelleği kaydet
+    saveSnapshot();
 }
 
-bool DataCache::remove(const std::string& key) {
-    std::lock_guard<std::mutex> lock(cacheMutex_);
+bool DataCache::remove(std::string_view key) {
+    std::unique_lock<std::mutex> lock;
+    CacheShard& shard = lockShard(key, lock);
     
-    // Anahtarı kontrol et
-    auto it = cache_.find(key);
-    if (it == cache_.end()) {
+    if (!removeLocked(shard, key)) {
         return false;
     }
     
-    // Önbellekten sil
-    cache_.erase(it);
-    
     // İstatistikleri güncelle
-    {
-        std::lock_guard<std::mutex> statsLock(statsMutex_);
-        stats_["remove"]++;
-    }
+    stats_.add(CacheStat::REMOVE);
     
     return true;
 }
 
-bool DataCache::has(const std::string& key) {
-    std::lock_guard<std::mutex> lock(cacheMutex_);
+bool DataCache::removeLocked(CacheShard& shard, std::string_view key) {
+    // Disk taşma katmanındaki ve paylaşımlı segmentteki kaydı da sil
+    bool removed = false;
+    if (spillEnabled_.load(std::memory_order_relaxed)) {
+        auto spill = std::atomic_load(&spill_);
+        removed = spill && spill->remove(key);
+    }
+    if (sharedEnabled_.load(std::memory_order_relaxed)) {
+        auto shared = std::atomic_load(&shared_);
+        removed = (shared && shared->remove(key)) || removed;
+    }
     
     // Anahtarı kontrol et
-    auto it = cache_.find(key);
-    if (it == cache_.end()) {
-        return false;
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end()) {
+        return removed;
+    }
+    
+    // Önbellekten sil
+    eraseEntry(shard, it, CacheRemovalReason::REMOVED);
+    
+    return true;
+}
+
+bool DataCache::has(std::string_view key) {
+    std::unique_lock<std::mutex> lock;
+    CacheShard& shard = lockShard(key, lock);
+    
+    // Anahtarı kontrol et, bellekte yoksa disk taşma katmanına ve paylaşımlı segmente bak
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end()) {
+        int64_t nowMs = toEpochMillis(CoarseClock::now());
+        
+        auto spill = spillEnabled_.load(std::memory_order_relaxed) ? std::atomic_load(&spill_) : nullptr;
+        if (spill && spill->contains(key, nowMs)) {
+            return true;
+        }
+        
+        auto shared = sharedEnabled_.load(std::memory_order_relaxed) ? std::atomic_load(&shared_) : nullptr;
+        std::string buffer;
+        CacheSnapshotRecord record;
+        return shared && shared->get(key, nowMs, buffer, record);
     }
     
     // Sona erme zamanını kontrol et
-    if (it->second.expiresAt != std::chrono::system_clock::time_point::max() && it->second.expiresAt <= std::chrono::system_clock::now()) {
+    if (it->second->expiresAt != CoarseClock::time_point::max() && it->second->expiresAt <= CoarseClock::now()) {
         // Süresi dolmuş girdiyi sil
-        cache_.erase(it);
+        eraseEntry(shard, it, CacheRemovalReason::EXPIRED);
         
         // İstatistikleri güncelle
-        {
-            std::lock_guard<std::mutex> statsLock(statsMutex_);
-            stats_["expired"]++;
-        }
+        stats_.add(CacheStat::EXPIRED);
         
         return false;
     }
@@ -73,71 +198,148 @@ bool DataCache::has(const std::string& key) {
 }
 
 void DataCache::clear() {
-    std::lock_guard<std::mutex> lock(cacheMutex_);
+    // Parçaları tek tek temizle; süren paylaşımlı yazmaların bitmesi beklenir
+    for (size_t i = 0; i < shardCount_.load(std::memory_order_acquire); i++) {
+        std::lock_guard<std::mutex> publishLock(shards_[i].publishMutex);
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        
+        // Dinleyicilere temizlenen girdileri bildir
+        if (removalDispatcher_.hasListeners()) {
+            for (auto& pair : shards_[i].entries) {
+                notifyRemoval(*pair.second, CacheRemovalReason::CLEARED);
+            }
+        }
+        
+        shards_[i].entries.clear();
+        shards_[i].eviction.clear();
+        shards_[i].window.clear();
+        shards_[i].sketch.clear();
+        shards_[i].expiry.clear();
+        shards_[i].tags.clear();
+        shards_[i].freeNodes.clear();
+        shards_[i].pendingSpills.clear();
+        shards_[i].pendingPublishes.clear();
+        shards_[i].resetBytes();
+    }
     
-    // Önbelleği temizle
-    cache_.clear();
+    // Ön önbellek kopyalarını tek seferde geçersiz kıl
+    invalidateFrontCache();
     
-    // İstatistikleri güncelle
-    {
-        std::lock_guard<std::mutex> statsLock(statsMutex_);
-        stats_["clear"]++;
+    // Disk taşma katmanını temizle
+    auto spill = std::atomic_load(&spill_);
+    if (spill) {
+        spill->clear();
+    }
+    
+    // Temizlenen girdiler segmentten yeniden okunmasın diye paylaşımlı segmenti temizle
+    auto shared = std::atomic_load(&shared_);
+    if (shared) {
+        shared->clear();
     }
+    
+    // İstatistikleri güncelle
+    stats_.add(CacheStat::CLEAR);
 }
 
 size_t DataCache::clearExpired() {
-    std::lock_guard<std::mutex> lock(cacheMutex_);
-    
     size_t count = 0;
-    auto now = std::chrono::system_clock::now();
+    auto now = CoarseClock::now();
     
-    // Süresi dolmuş girdileri temizle
-    for (auto it = cache_.begin(); it != cache_.end();) {
-        if (it->second.expiresAt != std::chrono::system_clock::time_point::max() && it->second.expiresAt <= now) {
-            it = cache_.erase(it);
-            count++;
-        } else {
-            ++it;
+    // Süresi dolmuş girdileri parça parça, dilimler halinde temizle
+    for (size_t i = 0; i < shardCount_.load(std::memory_order_acquire); i++) {
+        CacheShard& shard = shards_[i];
+        size_t popped = kExpirySliceSize;
+        
+        while (popped == kExpirySliceSize) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            
+            popped = shard.expiry.popDue(now, kExpirySliceSize, [&](const std::string& key, CoarseClock::time_point expiresAt) {
+                // Silinmiş veya yeniden yazılmış girdilerin kayıtlarını atla
+                auto it = shard.entries.find(key);
+                if (it != shard.entries.end() && it->second->expiresAt == expiresAt) {
+                    eraseEntry(shard, it, CacheRemovalReason::EXPIRED);
+                    count++;
+                }
+            });
+            
+            if (popped < kExpirySliceSize) {
+                compactExpiry(shard);
+            }
         }
     }
     
     // İstatistikleri güncelle
-    {
-        std::lock_guard<std::mutex> statsLock(statsMutex_);
-        stats_["expired"] += count;
-        stats_["clearExpired"]++;
-    }
+    stats_.add(CacheStat::EXPIRED, count);
+    stats_.add(CacheStat::CLEAR_EXPIRED);
     
     return count;
 }
 
 size_t DataCache::clearByTags(const std::string& tags) {
-    std::lock_guard<std::mutex> lock(cacheMutex_);
-    
     size_t count = 0;
+    std::vector<std::string> parsedTags = parseCacheTags(tags);
     
-    // Etiketlere göre girdileri temizle
-    for (auto it = cache_.begin(); it != cache_.end();) {
-        if (it->second.tags.find(tags) != std::string::npos) {
-            it = cache_.erase(it);
+    // Etiketlere göre girdileri parça parça temizle
+    for (size_t i = 0; !parsedTags.empty() && i < shardCount_.load(std::memory_order_acquire); i++) {
+        CacheShard& shard = shards_[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        
+        // Eşleşen anahtarları etiket dizininden bul
+        std::vector<std::string_view> keys = shard.tags.match(parsedTags, [&shard](std::string_view key, const std::string& tag) {
+            const auto& entryTags = shard.entries.at(key)->tags;
+            return std::binary_search(entryTags.begin(), entryTags.end(), tag);
+        });
+        
+        for (std::string_view key : keys) {
+            eraseEntry(shard, shard.entries.find(key), CacheRemovalReason::REMOVED);
             count++;
-        } else {
-            ++it;
         }
     }
     
-    // İstatistikleri güncelle
-    {
-        std::lock_guard<std::mutex> statsLock(statsMutex_);
-        stats_["clearByTags"]++;
+    // Disk taşma katmanındaki eşleşen kayıtları sil
+    auto spill = std::atomic_load(&spill_);
+    if (spill && !parsedTags.empty()) {
+        count += spill->removeByTags(parsedTags);
+    }
+    
+    // Paylaşımlı segmentteki eşleşen kayıtları sil; yerel girdilerin kopyaları oldukları için sayılmaz
+    auto shared = std::atomic_load(&shared_);
+    if (shared && !parsedTags.empty()) {
+        shared->removeByTags(parsedTags);
     }
     
+    // İstatistikleri güncelle
+    stats_.add(CacheStat::CLEAR_BY_TAGS);
+    
     return count;
 }
 
+std::vector<std::string> DataCache::getKeysByTag(const std::string& tag) const {
+    std::vector<std::string> keys;
+    
+    // Parçaların etiket dizinlerini topla
+    for (size_t i = 0; i < shardCount_.load(std::memory_order_acquire); i++) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        
+        const auto* shardKeys = shards_[i].tags.find(tag);
+        if (shardKeys != nullptr) {
+            keys.insert(keys.end(), shardKeys->begin(), shardKeys->end());
+        }
+    }
+    
+    return keys;
+}
+
 size_t DataCache::size() const {
-    std::lock_guard<std::mutex> lock(cacheMutex_);
-    return cache_.size();
+    size_t total = 0;
+    
+    // Parça boyutlarını topla
+    for (size_t i = 0; i < shardCount_.load(std::memory_order_acquire); i++) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        total += shards_[i].entries.size();
+    }
+    
+    return total;
 }
 
 size_t DataCache::capacity() const {
@@ -147,8 +349,142 @@ size_t DataCache::capacity() const {
 void DataCache::setCapacity(size_t capacity) {
     capacity_ = capacity;
     
-    // Önbellek kapasitesini kontrol et
-    checkCapacity();
+    // Parça kapasitelerini kontrol et
+    std::vector<PendingSpill> spills;
+    for (size_t i = 0; i < shardCount_.load(std::memory_order_acquire); i++) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        checkCapacity(shards_[i]);
+        shards_[i].takePendingSpills(spills);
+    }
+    
+    // Tahliye edilen girdileri parça kilitleri dışında diske yaz
+    writeSpills(spills);
+}
+
+size_t DataCache::getMemoryBudget() const {
+    return memoryBudget_.load();
+}
+
+void DataCache::setMemoryBudget(size_t bytes) {
+    memoryBudget_ = bytes;
+    
+    // Parça bütçelerini kontrol et
+    std::vector<PendingSpill> spills;
+    for (size_t i = 0; i < shardCount_.load(std::memory_order_acquire); i++) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        checkCapacity(shards_[i]);
+        shards_[i].takePendingSpills(spills);
+    }
+    
+    // Tahliye edilen girdileri parça kilitleri dışında diske yaz
+    writeSpills(spills);
+}
+
+size_t DataCache::memoryUsage() const {
+    size_t total = 0;
+    
+    // Parça boyutlarını topla
+    for (size_t i = 0; i < shardCount_.load(std::memory_order_acquire); i++) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        total += shards_[i].bytes;
+    }
+    
+    return total;
+}
+
+size_t DataCache::getShardCount() const {
+    return shardCount_.load();
+}
+
+void DataCache::setShardCount(size_t count) {
+    // Parça sayısını 2'nin kuvvetine yuvarla
+    size_t newCount = 1;
+    while (newCount < count && newCount < kMaxShardCount) {
+        newCount <<= 1;
+    }
+    
+    // Eski ve yeni parçaları sırayla kilitle; diğer parçalar boştur
+    std::vector<std::unique_lock<std::mutex>> locks;
+    std::unique_lock<std::mutex> first(shards_[0].mutex);
+    size_t oldCount = shardCount_.load();
+    if (newCount == oldCount) {
+        return;
+    }
+    
+    locks.reserve(std::max(oldCount, newCount));
+    locks.push_back(std::move(first));
+    for (size_t i = 1; i < std::max(oldCount, newCount); i++) {
+        locks.emplace_back(shards_[i].mutex);
+    }
+    
+    // Kullanım sırasını koruyarak girdileri topla
+    std::vector<CacheEntry*> order;
+    std::vector<CacheEntryMap::node_type> nodes;
+    std::vector<std::pair<std::string, CacheLoad>> loading;
+    for (size_t i = 0; i < oldCount; i++) {
+        auto& shard = shards_[i];
+        for (EvictionList* list : {&shard.eviction, &shard.window}) {
+            for (EvictionHook* hook = list->front(); hook != nullptr; hook = list->next(hook)) {
+                order.push_back(static_cast<CacheEntry*>(hook));
+            }
+            list->clear();
+        }
+        shard.sketch.clear();
+        shard.expiry.clear();
+        shard.tags.clear();
+        shard.resetBytes();
+        
+        // Düğümler taşınırken girdi adresleri değişmez
+        while (!shard.entries.empty()) {
+            nodes.push_back(shard.entries.extract(shard.entries.begin()));
+        }
+        
+        for (auto& pair : shard.loading) {
+            loading.push_back(std::move(pair));
+        }
+        shard.loading.clear();
+        
+        // Kullanılmayacak parçaların boş düğümlerini bırak
+        if (i >= newCount) {
+            shard.freeNodes.clear();
+            shard.freeNodes.shrink_to_fit();
+        }
+    }
+    
+    // Girdileri yeni parçalara dağıt
+    std::hash<std::string_view> hasher;
+    for (auto& node : nodes) {
+        size_t index = hasher(node.key()) & (newCount - 1);
+        shards_[index].entries.insert(std::move(node));
+    }
+    
+    for (auto& pair : loading) {
+        shards_[hasher(pair.first) & (newCount - 1)].loading.emplace(std::move(pair.first), std::move(pair.second));
+    }
+    
+    for (CacheEntry* entry : order) {
+        CacheShard& shard = shards_[hasher(entry->key) & (newCount - 1)];
+        shard.listOf(*entry).insert(entry);
+        shard.tags.add(entry->key, entry->tags);
+        shard.addBytes(*entry);
+        
+        if (entry->expiresAt != CoarseClock::time_point::max()) {
+            shard.expiry.push(entry->key, entry->expiresAt);
+        }
+    }
+    
+    shardCount_ = newCount;
+    
+    // Parça kapasitelerini kontrol et
+    std::vector<PendingSpill> spills;
+    for (size_t i = 0; i < newCount; i++) {
+        checkCapacity(shards_[i]);
+        shards_[i].takePendingSpills(spills);
+    }
+    
+    // Tahliye edilen girdileri parça kilitleri bırakıldıktan sonra diske yaz
+    locks.clear();
+    writeSpills(spills);
 }
 
 std::chrono::seconds DataCache::getDefaultTtl() const {
@@ -160,114 +496,1154 @@ void DataCache::setDefaultTtl(std::chrono::seconds ttl) {
 }
 
 std::chrono::seconds DataCache::getCleanupInterval() const {
+    std::lock_guard<std::mutex> lock(maintenanceMutex_);
     return cleanupInterval_;
 }
 
 void DataCache::setCleanupInterval(std::chrono::seconds interval) {
-    cleanupInterval_ = interval;
+    std::lock_guard<std::mutex> lock(maintenanceMutex_);
+    
+    cleanupInterval_ = std::max(interval, std::chrono::seconds(1));
+    
+    // Çalışan temizleme görevini yeni aralıkla yeniden zamanla
+    if (cleanupTask_ != 0) {
+        scheduler_.reschedule(cleanupTask_, cleanupInterval_);
+    }
 }
 
 bool DataCache::startAutoCleanup() {
-    std::lock_guard<std::mutex> lock(autoCleanupMutex_);
+    std::lock_guard<std::mutex> lock(maintenanceMutex_);
     
     // Eğer otomatik temizleme zaten çalışıyorsa, false döndür
     if (isAutoCleanupRunning()) {
         return false;
     }
     
-    // Otomatik temizleme bayrağını ayarla
+    // Temizleme görevini zamanla, ilk temizleme hemen yapılır
     autoCleanupRunning_ = true;
+    cleanupTask_ = scheduler_.scheduleEvery([this]() {
+        autoCleanup();
+    }, cleanupInterval_);
+    
+    return true;
+}
+
+bool DataCache::stopAutoCleanup() {
+    MaintenanceScheduler::TaskId task;
+    {
+        std::lock_guard<std::mutex> lock(maintenanceMutex_);
+        
+        autoCleanupRunning_ = false;
+        task = cleanupTask_;
+        cleanupTask_ = 0;
+    }
+    
+    // Görev kilit dışında iptal edilir; çalışan temizlemenin bitmesi beklenir
+    if (task != 0) {
+        scheduler_.cancel(task);
+    }
+    
+    return true;
+}
+
+bool DataCache::isAutoCleanupRunning() const {
+    return autoCleanupRunning_;
+}
+
+size_t DataCache::saveSnapshot(const std::string& filePath) {
+    std::string path = filePath.empty() ? getSnapshotPath() : filePath;
+    if (path.empty()) {
+        return 0;
+    }
+    
+    // Kodlayıcıları kopyala
+    std::unordered_map<std::type_index, std::shared_ptr<const CacheSnapshotCodec>> codecs;
+    {
+        std::lock_guard<std::mutex> lock(snapshotMutex_);
+        codecs = snapshotCodecs_;
+    }
+    
+    // Kayıtlı tür yoksa dosya yazılmaz
+    if (codecs.empty()) {
+        return 0;
+    }
+    
+    CacheSnapshotWriter writer(path);
+    if (!writer.isOpen()) {
+        std::cerr << "Failed to open cache snapshot file: " << path << std::endl;
+        return 0;
+    }
+    
+    // Kilit altında kodlanıp kilit dışında yazılan girdi
+    struct EncodedEntry {
+        std::string key;
+        std::shared_ptr<const CacheSnapshotCodec> codec;
+        std::string tags;
+        std::string payload;
+        int64_t ttlSeconds;
+        int64_t expiresAtMs;
+        int64_t staleAtMs;
+    };
+    
+    size_t count = 0;
+    auto now = CoarseClock::now();
+    std::vector<EncodedEntry> encoded;
     
-    // Otomatik temizleme iş parçacığını başlat
-    autoCleanupThread_ = std::thread([this]() {
-        while (isAutoCleanupRunning()) {
-            // Süresi dolmuş girdileri temizle
-            clearExpired();
+    for (size_t i = 0; i < shardCount_.load(std::memory_order_acquire); i++) {
+        CacheShard& shard = shards_[i];
+        encoded.clear();
+        
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
             
-            // Temizleme aralığı kadar bekle
-            std::this_thread::sleep_for(cleanupInterval_);
+            // Yüklemede kullanım sırası korunsun diye en eskiden başla (pencere en yenileri tutar)
+            for (EvictionList* list : {&shard.eviction, &shard.window}) {
+                for (EvictionHook* hook = list->front(); hook != nullptr; hook = list->next(hook)) {
+                    const CacheEntry& entry = *static_cast<CacheEntry*>(hook);
+                    if (entry.expiresAt <= now) {
+                        continue;
+                    }
+                    
+                    // Sıkıştırılmış değerin kodlanmış hali yalnızca açılır
+                    const auto* compressed = std::any_cast<CompressedCacheValue>(&entry.data);
+                    std::shared_ptr<const CacheSnapshotCodec> codec;
+                    if (compressed != nullptr) {
+                        codec = compressed->codec;
+                    } else {
+                        auto it = codecs.find(std::type_index(entry.data.type()));
+                        if (it == codecs.end()) {
+                            continue;
+                        }
+                        codec = it->second;
+                    }
+                    
+                    EncodedEntry item{entry.key, codec, joinTags(entry.tags), std::string(), entry.ttl.count(), toEpochMillis(entry.expiresAt), toEpochMillis(entry.staleAt)};
+                    try {
+                        item.payload = compressed != nullptr ? compressed->decompress() : codec->encode(entry.data);
+                    } catch (const std::exception& e) {
+                        std::cerr << "Failed to encode cache entry " << entry.key << ": " << e.what() << std::endl;
+                        continue;
+                    }
+                    
+                    encoded.push_back(std::move(item));
+                }
+            }
         }
-    });
+        
+        // Dosyaya kilit dışında yaz
+        for (const auto& item : encoded) {
+            CacheSnapshotRecord record;
+            record.key = item.key;
+            record.type = item.codec->name;
+            record.tags = item.tags;
+            record.payload = item.payload;
+            record.ttlSeconds = item.ttlSeconds;
+            record.expiresAtMs = item.expiresAtMs;
+            record.staleAtMs = item.staleAtMs;
+            writer.write(record);
+        }
+        
+        count += encoded.size();
+    }
     
-    return true;
+    if (!writer.commit()) {
+        std::cerr << "Failed to write cache snapshot file: " << path << std::endl;
+        return 0;
+    }
+    
+    // İstatistikleri güncelle
+    stats_.add(CacheStat::SNAPSHOT_SAVED, count);
+    
+    return count;
 }
 
-bool DataCache::stopAutoCleanup() {
-    std::lock_guard<std::mutex> lock(autoCleanupMutex_);
+size_t DataCache::loadSnapshot(const std::string& filePath) {
+    auto start = std::chrono::steady_clock::now();
+    
+    std::string path = filePath.empty() ? getSnapshotPath() : filePath;
+    if (path.empty()) {
+        return 0;
+    }
+    
+    CacheSnapshotReader reader(path);
+    if (!reader.isOpen()) {
+        return 0;
+    }
+    
+    // Kodlayıcıları kopyala
+    std::unordered_map<std::string, std::shared_ptr<const CacheSnapshotCodec>> codecs;
+    {
+        std::lock_guard<std::mutex> lock(snapshotMutex_);
+        codecs = snapshotCodecsByName_;
+    }
+    
+    size_t count = 0;
+    auto now = CoarseClock::now();
+    CacheSnapshotRecord record;
+    
+    while (reader.next(record)) {
+        // Kapalıyken süresi dolmuş girdileri atla
+        auto expiresAt = fromEpochMillis(record.expiresAtMs);
+        if (expiresAt <= now) {
+            continue;
+        }
+        
+        auto codec = codecs.find(std::string(record.type));
+        if (codec == codecs.end()) {
+            continue;
+        }
+        
+        std::any data;
+        try {
+            data = codec->second->decode(record.payload);
+        } catch (const std::exception& e) {
+            std::cerr << "Failed to decode cache entry " << record.key << ": " << e.what() << std::endl;
+            continue;
+        }
+        
+        size_t size = codec->second->estimate(data) + record.key.size();
+        size = compressValue(data, size, record.key.size());
+        insertEntry(record.key, std::move(data), std::chrono::seconds(record.ttlSeconds), expiresAt, fromEpochMillis(record.staleAtMs),
+                    parseCacheTags(std::string(record.tags)), size);
+        count++;
+    }
+    
+    // Yükleme süresini kaydet ve ısınma ölçümünü başlat
+    auto end = std::chrono::steady_clock::now();
+    snapshotLoadMicros_ = static_cast<size_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
     
-    // Eğer otomatik temizleme çalışmıyorsa, true döndür
-    if (!isAutoCleanupRunning()) {
-        return true;
+    {
+        std::lock_guard<std::mutex> lock(snapshotMutex_);
+        warmupStart_ = end;
+        warmupBaseHits_ = stats_.get(CacheStat::HIT);
+        warmupBaseMisses_ = stats_.get(CacheStat::MISS);
+        warmupMillis_ = 0;
     }
+    warmupPending_.store(count > 0, std::memory_order_release);
     
-    // Otomatik temizleme bayrağını temizle
-    autoCleanupRunning_ = false;
+    // İstatistikleri güncelle
+    stats_.add(CacheStat::SNAPSHOT_LOADED, count);
     
-    // Otomatik temizleme iş parçacığını bekle
-    if (autoCleanupThread_.joinable()) {
-        autoCleanupThread_.join();
+    return count;
+}
+
+bool DataCache::enableSpill(const std::string& filePath, size_t byteBudget) {
+    auto spill = std::make_shared<CacheSpillStore>(filePath, byteBudget);
+    if (!spill->isOpen()) {
+        std::cerr << "Failed to open cache spill file: " << filePath << std::endl;
+        return false;
     }
     
+    std::atomic_store(&spill_, spill);
+    spillEnabled_ = true;
+    
     return true;
 }
 
-bool DataCache::isAutoCleanupRunning() const {
-    return autoCleanupRunning_;
+void DataCache::disableSpill() {
+    spillEnabled_ = false;
+    
+    // Segment dosyası son referansla birlikte silinir
+    std::atomic_store(&spill_, std::shared_ptr<CacheSpillStore>());
 }
 
-std::unordered_map<std::string, size_t> DataCache::getStats() const {
-    std::lock_guard<std::mutex> lock(statsMutex_);
-    return stats_;
+bool DataCache::isSpillEnabled() const {
+    return spillEnabled_.load();
 }
 
-void DataCache::resetStats() {
-    std::lock_guard<std::mutex> lock(statsMutex_);
+bool DataCache::enableSharedSegment(const std::string& name, size_t slotCount, size_t slotSize) {
+    auto shared = std::make_shared<CacheSharedSegment>(name, slotCount, slotSize);
+    if (!shared->isOpen()) {
+        std::cerr << "Failed to open cache shared segment: " << name << std::endl;
+        return false;
+    }
     
-    // İstatistikleri sıfırla
-    stats_["hit"] = 0;
-    stats_["miss"] = 0;
-    stats_["set"] = 0;
-    stats_["remove"] = 0;
-    stats_["clear"] = 0;
-    stats_["clearExpired"] = 0;
-    stats_["clearByTags"] = 0;
-    stats_["expired"] = 0;
-    stats_["error"] = 0;
+    std::atomic_store(&shared_, shared);
+    sharedEnabled_ = true;
+    
+    return true;
 }
 
-void DataCache::autoCleanup() {
-    // Süresi dolmuş girdileri temizle
-    clearExpired();
+void DataCache::disableSharedSegment() {
+    sharedEnabled_ = false;
+    
+    // Segment diğer süreçler için korunur; yalnızca eşleme kapatılır
+    std::atomic_store(&shared_, std::shared_ptr<CacheSharedSegment>());
 }
 
-void DataCache::checkCapacity() {
-    // Eğer önbellek kapasitesi aşılmışsa, en eski girdileri sil
-    if (cache_.size() > capacity_) {
-        // Girdileri oluşturulma zamanına göre sırala
-        std::vector<std::pair<std::string, std::chrono::system_clock::time_point>> entries;
-        
-        for (const auto& pair : cache_) {
-            entries.push_back(std::make_pair(pair.first, pair.second.createdAt));
-        }
-        
-        // Oluşturulma zamanına göre sırala (en eski en başta)
-        std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
-            return a.second < b.second;
-        });
-        
-        // Kapasiteyi aşan girdileri sil
-        size_t removeCount = cache_.size() - capacity_;
+bool DataCache::isSharedSegmentEnabled() const {
+    return sharedEnabled_.load();
+}
+
+size_t DataCache::addRemovalListener(CacheRemovalListener listener) {
+    return removalDispatcher_.addListener(std::move(listener));
+}
+
+bool DataCache::removeRemovalListener(size_t id) {
+    return removalDispatcher_.removeListener(id);
+}
+
+void DataCache::flushRemovalListeners() {
+    removalDispatcher_.flush();
+}
+
+size_t DataCache::getListenerQueueCapacity() const {
+    return removalDispatcher_.getQueueCapacity();
+}
+
+void DataCache::setListenerQueueCapacity(size_t capacity) {
+    removalDispatcher_.setQueueCapacity(capacity);
+}
+
+void DataCache::setFrontCacheEnabled(bool enabled) {
+    frontCacheEnabled_.store(enabled);
+    
+    // Devre dışıyken yapılan değişiklikler sürümü artırmadığı için eski kopyalar geçersiz kılınır
+    frontEpoch_.fetch_add(1);
+}
+
+bool DataCache::isFrontCacheEnabled() const {
+    return frontCacheEnabled_.load();
+}
+
+size_t DataCache::getCompressionThreshold() const {
+    return compressionThreshold_.load();
+}
+
+void DataCache::setCompressionThreshold(size_t bytes) {
+    compressionThreshold_ = bytes;
+}
+
+std::string DataCache::getSnapshotPath() const {
+    std::lock_guard<std::mutex> lock(maintenanceMutex_);
+    return snapshotPath_;
+}
+
+void DataCache::setSnapshotPath(const std::string& filePath) {
+    std::lock_guard<std::mutex> lock(maintenanceMutex_);
+    snapshotPath_ = filePath;
+}
+
+std::chrono::seconds DataCache::getSnapshotInterval() const {
+    std::lock_guard<std::mutex> lock(maintenanceMutex_);
+    return snapshotInterval_;
+}
+
+void DataCache::setSnapshotInterval(std::chrono::seconds interval) {
+    MaintenanceScheduler::TaskId previous;
+    {
+        std::lock_guard<std::mutex> lock(maintenanceMutex_);
         
-        for (size_t i = 0; i < removeCount && i < entries.size(); i++) {
-            cache_.erase(entries[i].first);
-        }
+        snapshotInterval_ = interval;
+        previous = snapshotTask_;
+        snapshotTask_ = 0;
         
-        // İstatistikleri güncelle
-        {
-            std::lock_guard<std::mutex> statsLock(statsMutex_);
-            stats_["capacityExceeded"]++;
+        // Periyodik kaydı zamanla; yol boşsa saveSnapshot hiçbir şey yazmaz
+        if (interval.count() > 0) {
+            snapshotTask_ = scheduler_.scheduleEvery([this]() {
+                saveSnapshot();
+            }, interval, interval);
         }
     }
+    
+    // Önceki görev kilit dışında iptal edilir; görev kaydederken bakım kilidini alır
+    if (previous != 0) {
+        scheduler_.cancel(previous);
+    }
+}
+
+void DataCache::addSnapshotCodec(std::type_index type, std::shared_ptr<const CacheSnapshotCodec> codec) {
+    std::lock_guard<std::mutex> lock(snapshotMutex_);
+    
+    snapshotCodecsByName_[codec->name] = codec;
+    snapshotCodecs_[type] = std::move(codec);
+}
+
+void DataCache::checkWarmup() {
+    // Başka bir iş parçacığı kontrol ediyorsa okumayı bekletme
+    std::unique_lock<std::mutex> lock(snapshotMutex_, std::try_to_lock);
+    if (!lock.owns_lock() || !warmupPending_.load(std::memory_order_relaxed)) {
+        return;
+    }
+    
+    size_t hits = stats_.get(CacheStat::HIT) - warmupBaseHits_;
+    size_t misses = stats_.get(CacheStat::MISS) - warmupBaseMisses_;
+    size_t lookups = hits + misses;
+    
+    // İsabet oranı eşiğe ulaştıysa ısınma süresini kaydet
+    if (lookups >= kWarmupMinLookups && hits * 100 >= lookups * kWarmupHitRatio) {
+        auto elapsed = std::chrono::steady_clock::now() - warmupStart_;
+        warmupMillis_ = std::max<size_t>(1, static_cast<size_t>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()));
+        warmupPending_.store(false, std::memory_order_relaxed);
+    }
+}
+
+std::unordered_map<std::string, size_t> DataCache::getStats() const {
+    // Sayaç şeritlerini topla
+    auto stats = stats_.snapshot();
+    
+    // Ön önbellek isabetleri de isabettir
+    stats["hit"] += stats["frontHit"];
+    
+    // Bellek kullanımını ekle
+    size_t entries = 0;
+    size_t bytes = 0;
+    size_t freeNodes = 0;
+    size_t compressedEntries = 0;
+    size_t compressedBytes = 0;
+    size_t rawBytes = 0;
+    for (size_t i = 0; i < shardCount_.load(std::memory_order_acquire); i++) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        entries += shards_[i].entries.size();
+        bytes += shards_[i].bytes;
+        freeNodes += shards_[i].freeNodes.size();
+        compressedEntries += shards_[i].compressedEntries;
+        compressedBytes += shards_[i].compressedBytes;
+        rawBytes += shards_[i].rawBytes;
+    }
+    
+    stats["bytes"] = bytes;
+    stats["memoryBudget"] = memoryBudget_.load();
+    stats["averageEntryBytes"] = entries == 0 ? 0 : bytes / entries;
+    stats["freeNodes"] = freeNodes;
+    stats["compressionThreshold"] = compressionThreshold_.load();
+    stats["compressedEntries"] = compressedEntries;
+    stats["compressedBytes"] = compressedBytes;
+    stats["uncompressedBytes"] = rawBytes;
+    stats["snapshotLoadMicros"] = snapshotLoadMicros_.load();
+    stats["warmupMillis"] = warmupMillis_.load();
+    
+    // Disk taşma katmanı kullanımını ekle
+    auto spill = std::atomic_load(&spill_);
+    stats["spillEntries"] = spill ? spill->size() : 0;
+    stats["spillBytes"] = spill ? spill->bytes() : 0;
+    stats["spillFileBytes"] = spill ? spill->fileSize() : 0;
+    stats["spillCompactions"] = spill ? spill->compactions() : 0;
+    
+    // Paylaşımlı segment kullanımını ekle
+    auto shared = std::atomic_load(&shared_);
+    stats["sharedEntries"] = shared ? shared->size() : 0;
+    stats["sharedSlots"] = shared ? shared->slotCount() : 0;
+    
+    return stats;
+}
+
+void DataCache::resetStats() {
+    // İstatistikleri sıfırla
+    stats_.reset();
+}
+
+void DataCache::autoCleanup() {
+    // Süresi dolmuş girdileri temizle
+    clearExpired();
+}
+
+bool DataCache::unregisterLoader(std::string_view key) {
+    std::lock_guard<std::mutex> lock(loadersMutex_);
+    
+    return loaders_.erase(key) > 0;
+}
+
+bool DataCache::refresh(std::string_view key) {
+    // Yükleyici kayıtlı değilse yenileme planlanmaz
+    return scheduleRefresh(key);
+}
+
+void DataCache::addLoader(std::string_view key, std::function<void()> loader) {
+    {
+        std::lock_guard<std::mutex> lock(loadersMutex_);
+        
+        auto it = loaders_.find(key);
+        if (it == loaders_.end()) {
+            auto entry = std::make_unique<CacheRefreshLoader>();
+            entry->key = std::string(key);
+            std::string_view view(entry->key);
+            it = loaders_.emplace(view, std::move(entry)).first;
+        }
+        it->second->loader = std::make_shared<std::function<void()>>(std::move(loader));
+    }
+    
+    // İlk yüklemeyi planla
+    scheduleRefresh(key);
+}
+
+bool DataCache::scheduleRefresh(std::string_view key) {
+    // Yükleyici kayıtlı değilse dizge ayırmadan ve görev göndermeden çık
+    {
+        std::lock_guard<std::mutex> lock(loadersMutex_);
+        if (loaders_.find(key) == loaders_.end()) {
+            return false;
+        }
+    }
+    
+    std::lock_guard<std::mutex> lock(maintenanceMutex_);
+    
+    // Aynı anahtar için bekleyen veya süren yenileme varsa tekrar planlama
+    std::string name(key);
+    if (refreshTasks_.find(name) != refreshTasks_.end()) {
+        return false;
+    }
+    
+    // Yükleyici zamanlayıcı iş parçacığını bekletmesin diye iş havuzunda çalışır
+    // Görev, bu kilit bırakılmadan kaydını silemez
+    MaintenanceScheduler::TaskId task = scheduler_.submit([this, name]() {
+        runRefresh(name);
+        
+        std::lock_guard<std::mutex> lock(maintenanceMutex_);
+        refreshTasks_.erase(name);
+    });
+    refreshTasks_.emplace(std::move(name), task);
+    
+    return true;
+}
+
+void DataCache::runRefresh(const std::string& key) {
+    std::shared_ptr<std::function<void()>> loader;
+    
+    {
+        std::lock_guard<std::mutex> lock(loadersMutex_);
+        
+        auto it = loaders_.find(key);
+        if (it == loaders_.end()) {
+            return;
+        }
+        
+        loader = it->second->loader;
+    }
+    
+    // İstatistikleri güncelle
+    stats_.add(CacheStat::REFRESH);
+    
+    // Yükleyici hatası bayat değeri korur; girdi sert TTL dolunca silinir
+    try {
+        (*loader)();
+    } catch (const std::exception& e) {
+        stats_.add(CacheStat::REFRESH_ERROR);
+        std::cerr << "Failed to refresh cache entry " << key << ": " << e.what() << std::endl;
+    } catch (...) {
+        stats_.add(CacheStat::REFRESH_ERROR);
+    }
+}
+
+void DataCache::cancelMaintenance() {
+    std::vector<MaintenanceScheduler::TaskId> tasks;
+    {
+        std::lock_guard<std::mutex> lock(maintenanceMutex_);
+        
+        if (snapshotTask_ != 0) {
+            tasks.push_back(snapshotTask_);
+            snapshotTask_ = 0;
+        }
+        
+        for (const auto& pair : refreshTasks_) {
+            tasks.push_back(pair.second);
+        }
+        refreshTasks_.clear();
+    }
+    
+    // Görevler kilit dışında iptal edilir; çalışan görevlerin bitmesi beklenir
+    for (MaintenanceScheduler::TaskId task : tasks) {
+        scheduler_.cancel(task);
+    }
+}
+
+CacheShard& DataCache::lockShard(std::string_view key, std::unique_lock<std::mutex>& lock) const {
+    size_t hash = std::hash<std::string_view>()(key);
+    
+    while (true) {
+        size_t count = shardCount_.load(std::memory_order_acquire);
+        CacheShard& shard = shards_[hash & (count - 1)];
+        lock = std::unique_lock<std::mutex>(shard.mutex);
+        
+        // Parça sayısı yalnızca tüm kilitler tutulurken değişir
+        if (count == shardCount_.load(std::memory_order_relaxed)) {
+            return shard;
+        }
+        
+        lock.unlock();
+    }
+}
+
+size_t DataCache::shardCapacity() const {
+    size_t count = shardCount_.load();
+    return (capacity_.load() + count - 1) / count;
+}
+
+EvictionPolicy DataCache::getEvictionPolicy() const {
+    return evictionPolicy_.load();
+}
+
+void DataCache::setEvictionPolicy(EvictionPolicy policy) {
+    evictionPolicy_ = policy;
+    
+    // Parçaların tahliye listelerini güncelle
+    for (size_t i = 0; i < kMaxShardCount; i++) {
+        std::lock_guard<std::mutex> lock(shards_[i].mutex);
+        shards_[i].eviction.setPolicy(policy);
+    }
+}
+
+CacheAdmissionPolicy DataCache::getAdmissionPolicy() const {
+    return admissionPolicy_.load();
+}
+
+void DataCache::setAdmissionPolicy(CacheAdmissionPolicy policy) {
+    admissionPolicy_ = policy;
+    
+    for (size_t i = 0; i < shardCount_.load(std::memory_order_acquire); i++) {
+        CacheShard& shard = shards_[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        
+        if (policy == CacheAdmissionPolicy::TINY_LFU) {
+            shard.sketch.ensureCapacity(shardCapacity());
+            continue;
+        }
+        
+        // Penceredeki girdileri kullanım sırasıyla ana bölgeye taşı
+        while (auto* entry = static_cast<CacheEntry*>(shard.window.front())) {
+            shard.window.erase(entry);
+            entry->inWindow = false;
+            shard.eviction.insert(entry);
+        }
+        shard.sketch.clear();
+    }
+}
+
+void DataCache::checkCapacity(CacheShard& shard) {
+    size_t capacity = shardCapacity();
+    size_t count = shardCount_.load();
+    size_t budget = memoryBudget_.load();
+    size_t shardBudget = budget == 0 ? 0 : (budget + count - 1) / count;
+    bool tinyLfu = admissionPolicy_.load(std::memory_order_relaxed) == CacheAdmissionPolicy::TINY_LFU;
+    size_t windowCapacity = std::max<size_t>(1, capacity / 100);
+    
+    auto exceeded = [&]() {
+        return shard.entries.size() > capacity || (shardBudget > 0 && shard.bytes > shardBudget);
+    };
+    
+    auto evict = [&](CacheEntry* entry) {
+        // Yer kilit altında ayrılır; aynı anahtara sonradan yapılan yazma ayrılan yeri geçersiz kılar
+        if (spillEnabled_.load(std::memory_order_relaxed)) {
+            spillEntry(shard, *entry);
+        }
+        
+        eraseEntry(shard, shard.entries.find(entry->key), CacheRemovalReason::EVICTED);
+    };
+    
+    auto admit = [&](CacheEntry* entry) {
+        shard.window.erase(entry);
+        entry->inWindow = false;
+        shard.eviction.insert(entry);
+    };
+    
+    if (tinyLfu) {
+        shard.sketch.ensureCapacity(capacity);
+    }
+    
+    // Eğer parça kapasitesi veya bütçesi aşılmışsa, politikanın seçtiği girdileri sil
+    if (exceeded()) {
+        while (exceeded()) {
+            auto* candidate = static_cast<CacheEntry*>(shard.window.size() > windowCapacity ? shard.window.victim() : nullptr);
+            auto* victim = static_cast<CacheEntry*>(shard.eviction.victim());
+            
+            if (candidate != nullptr && victim != nullptr) {
+                // Pencereden taşan aday, ana bölgenin kurbanıyla sıklık karşılaştırmasıyla yarışır
+                std::hash<std::string_view> hasher;
+                if (shard.sketch.estimate(hasher(candidate->key)) > shard.sketch.estimate(hasher(victim->key))) {
+                    evict(victim);
+                    admit(candidate);
+                } else {
+                    evict(candidate);
+                    stats_.add(CacheStat::ADMISSION_REJECTED);
+                }
+            } else if (victim != nullptr) {
+                evict(victim);
+            } else if (shard.window.size() > 0) {
+                evict(static_cast<CacheEntry*>(shard.window.victim()));
+            } else {
+                break;
+            }
+        }
+        
+        // İstatistikleri güncelle
+        stats_.add(CacheStat::CAPACITY_EXCEEDED);
+    }
+    
+    // Ana bölgede yer varsa pencereden taşanları kabul et
+    while (shard.window.size() > windowCapacity) {
+        admit(static_cast<CacheEntry*>(shard.window.victim()));
+    }
+}
+
+void DataCache::finishLoad(std::string_view key) {
+    std::unique_lock<std::mutex> lock;
+    CacheShard& shard = lockShard(key, lock);
+    
+    shard.loading.erase(std::string(key));
+}
+
+void DataCache::insertEntry(std::string_view key, std::any data, std::chrono::seconds ttl,
+                            CoarseClock::time_point expiresAt, CoarseClock::time_point staleAt,
+                            std::vector<std::string> tags, size_t size) {
+    std::unique_lock<std::mutex> lock;
+    CacheShard& shard = lockShard(key, lock);
+    
+    insertLocked(shard, key, std::move(data), ttl, expiresAt, staleAt, std::move(tags), size);
+    bool shared = sharedEnabled_.load(std::memory_order_relaxed);
+    if (shared) {
+        publishShared(shard, key);
+    }
+    
+    // Tahliye edilen girdileri diske, yeni değeri paylaşımlı segmente parça kilidi dışında yaz
+    if (shared || !shard.pendingSpills.empty()) {
+        std::vector<PendingSpill> spills;
+        shard.takePendingSpills(spills);
+        lock.unlock();
+        writeSpills(spills);
+        if (shared) {
+            flushShared(shard);
+        }
+    }
+    
+    // İstatistikleri güncelle
+    stats_.add(CacheStat::SET);
+}
+
+void DataCache::insertLocked(CacheShard& shard, std::string_view key, std::any data, std::chrono::seconds ttl,
+                             CoarseClock::time_point expiresAt, CoarseClock::time_point staleAt,
+                             std::vector<std::string> tags, size_t size) {
+    // Disk taşma katmanındaki eski kaydı geçersiz kıl
+    if (spillEnabled_.load(std::memory_order_relaxed)) {
+        auto spill = std::atomic_load(&spill_);
+        if (spill) {
+            spill->remove(key);
+        }
+    }
+    
+    // Önbellek girdisini bul veya oluştur
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end() && !shard.freeNodes.empty()) {
+        // Boş düğümü yeniden kullan; anahtar sığıyorsa arabelleği de yeniden ayrılmaz
+        auto node = std::move(shard.freeNodes.back());
+        shard.freeNodes.pop_back();
+        
+        node.mapped()->key.assign(key.data(), key.size());
+        node.key() = std::string_view(node.mapped()->key);
+        it = shard.entries.insert(std::move(node)).position;
+        stats_.add(CacheStat::ENTRY_REUSED);
+        
+        // W-TinyLFU'da yeni girdiler pencereden başlar
+        it->second->inWindow = admissionPolicy_.load(std::memory_order_relaxed) == CacheAdmissionPolicy::TINY_LFU;
+    } else if (it == shard.entries.end()) {
+        auto newEntry = std::make_unique<CacheEntry>();
+        newEntry->key = std::string(key);
+        std::string_view storedKey(newEntry->key);
+        it = shard.entries.emplace(storedKey, std::move(newEntry)).first;
+        stats_.add(CacheStat::ENTRY_ALLOCATED);
+        
+        // W-TinyLFU'da yeni girdiler pencereden başlar
+        it->second->inWindow = admissionPolicy_.load(std::memory_order_relaxed) == CacheAdmissionPolicy::TINY_LFU;
+    } else {
+        shard.listOf(*it->second).erase(it->second.get());
+        shard.tags.remove(it->first, it->second->tags);
+        shard.removeBytes(*it->second);
+        
+        // Dinleyicilere eski değeri bildir
+        notifyRemoval(*it->second, CacheRemovalReason::REPLACED);
+    }
+    
+    CacheEntry& entry = *it->second;
+    entry.data = std::move(data);
+    entry.createdAt = CoarseClock::now();
+    entry.ttl = ttl;
+    entry.expiresAt = expiresAt;
+    entry.staleAt = staleAt;
+    
+    // Süreli girdiyi sona erme kuyruğuna ekle
+    if (expiresAt != CoarseClock::time_point::max()) {
+        shard.expiry.push(entry.key, expiresAt);
+        
+        // Yoğun yazmada eski kayıtlar otomatik temizlemeyi beklemeden atılır
+        compactExpiry(shard);
+    }
+    
+    entry.tags = std::move(tags);
+    shard.tags.add(it->first, entry.tags);
+    
+    // Sıkıştırılmış değerin özgün boyutu ayrıca sayılır
+    const auto* compressed = std::any_cast<CompressedCacheValue>(&entry.data);
+    entry.size = size;
+    entry.rawSize = compressed != nullptr ? compressed->rawSize : 0;
+    shard.addBytes(entry);
+    
+    // Tahliye listesine ekle
+    shard.listOf(entry).insert(&entry);
+    invalidateFrontCache();
+    
+    // Parça kapasitesini kontrol et
+    checkCapacity(shard);
+}
+
+void DataCache::compactExpiry(CacheShard& shard) {
+    // Sıkıştırmadan sonra yalnızca canlı kayıtlar kalır; maliyet sonraki yazmalara yayılır
+    if (shard.expiry.size() <= 2 * shard.entries.size() + kExpirySliceSize) {
+        return;
+    }
+    
+    shard.expiry.compact([&shard](const std::string& key, CoarseClock::time_point expiresAt) {
+        auto it = shard.entries.find(key);
+        return it != shard.entries.end() && it->second->expiresAt == expiresAt;
+    });
+}
+
+size_t DataCache::compressValue(std::any& data, size_t size, size_t keySize) {
+    size_t threshold = compressionThreshold_.load(std::memory_order_relaxed);
+    if (threshold == 0 || size < threshold) {
+        return size;
+    }
+    
+    // Kodlayıcıyı bul; kodlayıcısı olmayan türler sıkıştırılmaz
+    std::shared_ptr<const CacheSnapshotCodec> codec;
+    {
+        std::lock_guard<std::mutex> lock(snapshotMutex_);
+        
+        auto it = snapshotCodecs_.find(std::type_index(data.type()));
+        if (it == snapshotCodecs_.end()) {
+            return size;
+        }
+        
+        codec = it->second;
+    }
+    
+    CompressedCacheValue compressed;
+    try {
+        std::string encoded = codec->encode(data);
+        compressed.bytes = compressCacheBytes(encoded);
+        compressed.encodedSize = encoded.size();
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to compress cache value: " << e.what() << std::endl;
+        return size;
+    }
+    
+    // En az sekizde bir küçülmeyen değer sıkıştırılmadan saklanır
+    size_t compressedSize = compressed.bytes.size() + keySize;
+    if (compressedSize > size - size / 8) {
+        return size;
+    }
+    
+    compressed.bytes.shrink_to_fit();
+    compressed.rawSize = size;
+    compressed.type = std::type_index(data.type());
+    compressed.codec = std::move(codec);
+    data = std::move(compressed);
+    
+    // İstatistikleri güncelle
+    stats_.add(CacheStat::COMPRESS);
+    
+    return compressedSize;
+}
+
+std::any DataCache::decompressValue(const CacheEntry& entry, const std::type_info& type) {
+    const auto* compressed = std::any_cast<CompressedCacheValue>(&entry.data);
+    if (compressed == nullptr || compressed->type != std::type_index(type)) {
+        return std::any();
+    }
+    
+    try {
+        std::any value = compressed->value();
+        
+        // İstatistikleri güncelle
+        stats_.add(CacheStat::DECOMPRESS);
+        
+        return value;
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to decompress cache entry " << entry.key << ": " << e.what() << std::endl;
+        return std::any();
+    }
+}
+
+bool DataCache::encodeEntry(const CacheEntry& entry, std::string& tags, std::string& payload, CacheSnapshotRecord& record) {
+    // Kodlayıcıyı bul
+    const auto* compressed = std::any_cast<CompressedCacheValue>(&entry.data);
+    std::shared_ptr<const CacheSnapshotCodec> codec;
+    if (compressed != nullptr) {
+        codec = compressed->codec;
+    } else {
+        std::lock_guard<std::mutex> lock(snapshotMutex_);
+        
+        auto it = snapshotCodecs_.find(std::type_index(entry.data.type()));
+        if (it == snapshotCodecs_.end()) {
+            return false;
+        }
+        
+        codec = it->second;
+    }
+    
+    tags = joinTags(entry.tags);
+    try {
+        payload = compressed != nullptr ? compressed->decompress() : codec->encode(entry.data);
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to encode cache entry " << entry.key << ": " << e.what() << std::endl;
+        return false;
+    }
+    
+    record.key = entry.key;
+    record.type = codec->name;
+    record.tags = tags;
+    record.payload = payload;
+    record.ttlSeconds = entry.ttl.count();
+    record.expiresAtMs = toEpochMillis(entry.expiresAt);
+    record.staleAtMs = toEpochMillis(entry.staleAt);
+    
+    return true;
+}
+
+void DataCache::spillEntry(CacheShard& shard, const CacheEntry& entry) {
+    auto spill = std::atomic_load(&spill_);
+    if (!spill || entry.expiresAt <= CoarseClock::now()) {
+        return;
+    }
+    
+    std::string tags;
+    std::string payload;
+    CacheSnapshotRecord record;
+    if (!encodeEntry(entry, tags, payload, record)) {
+        return;
+    }
+    
+    // Yeri ayır, kaydı kodla; dosyaya yazma kilit dışında yapılır
+    PendingSpill pending;
+    pending.key = entry.key;
+    pending.ticket = spill->reserve(entry.key, record.expiresAtMs, entry.tags);
+    encodeCacheSnapshotRecord(record, pending.bytes);
+    shard.pendingSpills.push_back(std::move(pending));
+}
+
+void DataCache::writeSpills(std::vector<PendingSpill>& spills) {
+    if (spills.empty()) {
+        return;
+    }
+    
+    auto spill = std::atomic_load(&spill_);
+    size_t written = 0;
+    for (const auto& pending : spills) {
+        if (spill && spill->write(pending.key, pending.ticket, pending.bytes)) {
+            written++;
+        }
+    }
+    spills.clear();
+    
+    // İstatistikleri güncelle
+    if (written > 0) {
+        stats_.add(CacheStat::SPILL_WRITE, written);
+    }
+}
+
+void DataCache::finishDeferred(std::string_view key, CacheDeferredWork& deferred) {
+    if (deferred.stale) {
+        scheduleRefresh(key);
+    }
+    writeSpills(deferred.spills);
+}
+
+CacheEntryMap::iterator DataCache::promoteSpilled(CacheShard& shard, std::string_view key) {
+    auto spill = std::atomic_load(&spill_);
+    std::string buffer;
+    CacheSnapshotRecord record;
+    
+    if (!spill || !spill->take(key, buffer, record)) {
+        return shard.entries.end();
+    }
+    
+    // Süresi dolmuş kaydı atla
+    if (fromEpochMillis(record.expiresAtMs) <= CoarseClock::now()) {
+        stats_.add(CacheStat::EXPIRED);
+        return shard.entries.end();
+    }
+    
+    auto it = insertRecord(shard, key, record);
+    
+    // İstatistikleri güncelle
+    if (it != shard.entries.end()) {
+        stats_.add(CacheStat::SPILL_HIT);
+    }
+    
+    return it;
+}
+
+void DataCache::publishShared(CacheShard& shard, std::string_view key) {
+    auto shared = std::atomic_load(&shared_);
+    auto it = shard.entries.find(key);
+    if (!shared || it == shard.entries.end()) {
+        return;
+    }
+    
+    std::string tags;
+    std::string payload;
+    CacheSnapshotRecord record;
+    if (!encodeEntry(*it->second, tags, payload, record)) {
+        return;
+    }
+    
+    // Segmente yazma kilit dışında yapılır
+    PendingPublish pending;
+    pending.key = std::string(key);
+    pending.expiresAtMs = record.expiresAtMs;
+    encodeCacheSnapshotRecord(record, pending.bytes);
+    shard.pendingPublishes.push_back(std::move(pending));
+}
+
+void DataCache::flushShared(CacheShard& shard) {
+    std::lock_guard<std::mutex> publishLock(shard.publishMutex);
+    
+    // Kuyruğu al; başka bir çağıran zaten yazdıysa yapılacak iş kalmaz
+    std::vector<PendingPublish> batch;
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        batch.swap(shard.pendingPublishes);
+    }
+    
+    auto shared = std::atomic_load(&shared_);
+    if (!shared || batch.empty()) {
+        return;
+    }
+    
+    int64_t nowMs = toEpochMillis(CoarseClock::now());
+    size_t written = 0;
+    for (const auto& pending : batch) {
+        // Yuvaya sığmayan kayıt yazılamaz; segmentteki eski değer silinir
+        if (shared->put(pending.key, pending.expiresAtMs, pending.bytes, nowMs)) {
+            written++;
+        } else {
+            shared->remove(pending.key);
+        }
+    }
+    
+    // İstatistikleri güncelle
+    if (written > 0) {
+        stats_.add(CacheStat::SHARED_WRITE, written);
+    }
+}
+
+CacheEntryMap::iterator DataCache::promoteShared(CacheShard& shard, std::string_view key) {
+    auto shared = std::atomic_load(&shared_);
+    std::string buffer;
+    CacheSnapshotRecord record;
+    
+    if (!shared || !shared->get(key, toEpochMillis(CoarseClock::now()), buffer, record)) {
+        return shard.entries.end();
+    }
+    
+    auto it = insertRecord(shard, key, record);
+    
+    // İstatistikleri güncelle
+    if (it != shard.entries.end()) {
+        stats_.add(CacheStat::SHARED_HIT);
+    }
+    
+    return it;
+}
+
+CacheEntryMap::iterator DataCache::insertRecord(CacheShard& shard, std::string_view key, const CacheSnapshotRecord& record) {
+    // Kodlayıcıyı bul
+    std::shared_ptr<const CacheSnapshotCodec> codec;
+    {
+        std::lock_guard<std::mutex> lock(snapshotMutex_);
+        
+        auto it = snapshotCodecsByName_.find(std::string(record.type));
+        if (it == snapshotCodecsByName_.end()) {
+            return shard.entries.end();
+        }
+        
+        codec = it->second;
+    }
+    
+    std::any data;
+    try {
+        data = codec->decode(record.payload);
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to decode cache entry " << record.key << ": " << e.what() << std::endl;
+        return shard.entries.end();
+    }
+    
+    // Girdiyi belleğe al
+    size_t size = codec->estimate(data) + key.size();
+    size = compressValue(data, size, key.size());
+    insertLocked(shard, key, std::move(data), std::chrono::seconds(record.ttlSeconds), fromEpochMillis(record.expiresAtMs),
+                 fromEpochMillis(record.staleAtMs), parseCacheTags(std::string(record.tags)), size);
+    
+    return shard.entries.find(key);
+}
+
+void DataCache::notifyRemoval(CacheEntry& entry, CacheRemovalReason reason) {
+    if (!removalDispatcher_.hasListeners()) {
+        return;
+    }
+    
+    // Sıkıştırılmış değer kilit dışında, iletim iş parçacığında açılır
+    // Kuyruk doluysa olay düşürülür; yazmalar dinleyicileri beklemez
+    if (!removalDispatcher_.post(CacheRemovalEvent{entry.key, std::move(entry.data), reason})) {
+        stats_.add(CacheStat::LISTENER_DROPPED);
+    }
+}
+
+CacheEntryMap::iterator DataCache::eraseEntry(CacheShard& shard, CacheEntryMap::iterator it, CacheRemovalReason reason) {
+    // Tahliye listesinden ve etiket dizininden çıkar
+    shard.listOf(*it->second).erase(it->second.get());
+    shard.tags.remove(it->first, it->second->tags);
+    shard.removeBytes(*it->second);
+    
+    // Dinleyicilere bildir
+    notifyRemoval(*it->second, reason);
+    
+    // Düğümü haritadan çıkar; değer hemen bırakılır, düğüm yeniden kullanılır
+    auto next = std::next(it);
+    auto node = shard.entries.extract(it);
+    if (shard.freeNodes.size() < kMaxFreeNodes) {
+        CacheEntry& entry = *node.mapped();
+        entry.data.reset();
+        entry.tags.clear();
+        entry.size = 0;
+        entry.rawSize = 0;
+        shard.freeNodes.push_back(std::move(node));
+    }
+    invalidateFrontCache();
+    
+    return next;
+}
+
+const std::shared_ptr<const void>* DataCache::frontGet(std::string_view key, size_t hash, const std::type_info& type) {
+    FrontCacheSlot& slot = frontSlot(instanceId_, hash);
+    if (slot.cache != instanceId_ || slot.hash != hash || slot.key != key || !slot.value) {
+        return nullptr;
+    }
+    
+    // Önbellek değiştiyse veya girdinin süresi dolduysa kopyayı bırak
+    if (slot.epoch != frontEpoch_.load() || slot.expiresAt <= CoarseClock::now()) {
+        slot.value.reset();
+        return nullptr;
+    }
+    
+    if (*slot.type != type) {
+        return nullptr;
+    }
+    
+    // İsabet sayısına getStats() içinde eklenir
+    stats_.add(CacheStat::FRONT_HIT);
+    
+    return &slot.value;
+}
+
+void DataCache::frontPut(std::string_view key, size_t hash, const std::type_info& type, std::shared_ptr<const void> value,
+                         CoarseClock::time_point expiresAt, uint64_t epoch) {
+    FrontCacheSlot& slot = frontSlot(instanceId_, hash);
+    slot.cache = instanceId_;
+    slot.epoch = epoch;
+    slot.hash = hash;
+    slot.type = &type;
+    slot.expiresAt = expiresAt;
+    slot.key.assign(key.data(), key.size());
+    slot.value = std::move(value);
 }
 
 } // namespace data
@@ -3,6 +3,7 @@
 #include <fstream>
 #include <sstream>
 #include <filesystem>
+#include <algorithm>
 
 namespace alt_las {
 namespace data {
@@ -17,18 +18,38 @@ DataManager::DataManager()
       validator_(DataValidator::getInstance()),
       cache_(DataCache::getInstance()),
       dataDirectory_("data"),
-      dataExtension_(".json") {
+      dataExtension_(".json"),
+      cacheNamespaces_(std::make_shared<const CacheNamespaceMap>()),
+      hasCacheNamespaces_(false),
+      missingData_(kMissingDataCapacity, kDefaultMissingDataTtl),
+      missingDataEnabled_(true),
+      saveEpoch_(0),
+      reportTask_(0) {
+    
+    // Ad alanı önbellekleri bu nesneden sonra yok edilsin diye kayıt önce başlatılır
+    CacheRegistry::getInstance();
     
     // Veri dizinini oluştur
     createDataDirectory();
     
+    // Önbellek kapanırken veri dizinine kaydedilsin
+    cache_.setSnapshotPath(createCacheSnapshotPath());
+    
     // Önbellek otomatik temizlemeyi başlat
     cache_.startAutoCleanup();
+    missingData_.startAutoCleanup();
 }
 
 DataManager::~DataManager() {
+    // Periyodik rapor kaydını durdur
+    stopReportFlush();
+    
     // Önbellek otomatik temizlemeyi durdur
     cache_.stopAutoCleanup();
+    
+    // Tür güvenli önbelleklerin otomatik temizlemesi, son referansla birlikte durur
+    std::lock_guard<std::mutex> lock(typedCachesMutex_);
+    typedCaches_.clear();
 }
 
 DataSerializer& DataManager::getSerializer() {
@@ -43,22 +64,82 @@ DataCache& DataManager::getCache() {
     return cache_;
 }
 
-bool DataManager::removeData(const std::string& key) {
+std::shared_ptr<DataCache> DataManager::createCacheNamespace(const std::string& name, const CacheConfig& config) {
+    std::lock_guard<std::mutex> lock(cacheNamespacesMutex_);
+    
+    auto namespaces = std::atomic_load(&cacheNamespaces_);
+    auto it = namespaces->find(name);
+    if (it != namespaces->end()) {
+        return it->second;
+    }
+    
+    // Örneği kayıtta oluştur ve otomatik temizlemeyi başlat
+    auto cache = CacheRegistry::getInstance().getOrCreate(name, config);
+    cache->startAutoCleanup();
+    
+    // Okuyucuları kilitlememek için yeni eşlemeyi kopyalayıp yayımla
+    auto updated = std::make_shared<CacheNamespaceMap>(*namespaces);
+    updated->emplace(name, cache);
+    std::atomic_store(&cacheNamespaces_, std::shared_ptr<const CacheNamespaceMap>(std::move(updated)));
+    hasCacheNamespaces_.store(true, std::memory_order_release);
+    
+    return cache;
+}
+
+DataCache& DataManager::getCacheFor(std::string_view key) const {
+    // Ad alanı yoksa eşleme okunmaz
+    if (!hasCacheNamespaces_.load(std::memory_order_acquire)) {
+        return cache_;
+    }
+    
+    size_t separator = key.find(kNamespaceSeparator);
+    if (separator == std::string_view::npos) {
+        return cache_;
+    }
+    
+    auto namespaces = std::atomic_load(&cacheNamespaces_);
+    auto it = namespaces->find(key.substr(0, separator));
+    
+    // Ad alanı eşlemeden hiç çıkarılmadığı için örnek bu nesneyle birlikte yaşar
+    return it == namespaces->end() ? cache_ : *it->second;
+}
+
+std::vector<std::pair<DataCache*, std::vector<size_t>>> DataManager::groupByCache(const std::vector<std::string_view>& keys) const {
+    std::vector<std::pair<DataCache*, std::vector<size_t>>> groups;
+    
+    for (size_t i = 0; i < keys.size(); i++) {
+        DataCache* cache = &getCacheFor(keys[i]);
+        
+        // Ad alanı sayısı az olduğundan doğrusal arama yeterli
+        auto it = std::find_if(groups.begin(), groups.end(), [cache](const auto& group) {
+            return group.first == cache;
+        });
+        if (it == groups.end()) {
+            groups.emplace_back(cache, std::vector<size_t>());
+            it = groups.end() - 1;
+        }
+        it->second.push_back(i);
+    }
+    
+    return groups;
+}
+
+bool DataManager::removeData(std::string_view key) {
     // Veri yolunu oluştur
     std::string filePath = createDataPath(key);
     
     // Dosyayı sil
     bool success = std::filesystem::remove(filePath);
     
-    // Önbellekten sil
-    cache_.remove(key);
+    // Anahtarın önbelleğinden sil
+    getCacheFor(key).remove(key);
     
     return success;
 }
 
-bool DataManager::hasData(const std::string& key) {
-    // Önbellekte kontrol et
-    if (cache_.has(key)) {
+bool DataManager::hasData(std::string_view key) {
+    // Anahtarın önbelleğinde kontrol et
+    if (getCacheFor(key).has(key)) {
         return true;
     }
     
@@ -66,7 +147,55 @@ bool DataManager::hasData(const std::string& key) {
     std::string filePath = createDataPath(key);
     
     // Dosya varlığını kontrol et
-    return std::filesystem::exists(filePath);
+    return !isDataMissing(key, filePath);
+}
+
+bool DataManager::isDataMissing(std::string_view key, const std::string& filePath) {
+    if (!missingDataEnabled_.load(std::memory_order_relaxed)) {
+        return !std::filesystem::exists(filePath);
+    }
+    
+    // Yakın zamanda bulunamayan anahtar için dosya sistemine bakma
+    bool missing = false;
+    if (missingData_.tryGet(key, missing)) {
+        return true;
+    }
+    
+    // Sayaç kontrolden önce okunur; arada kaydedilen anahtar eksik olarak kalmaz
+    uint64_t epoch = saveEpoch_.load();
+    if (std::filesystem::exists(filePath)) {
+        return false;
+    }
+    
+    missingData_.set(std::string(key), true);
+    if (saveEpoch_.load() != epoch) {
+        missingData_.remove(key);
+    }
+    
+    return true;
+}
+
+void DataManager::forgetMissingData(std::string_view key) {
+    if (!missingDataEnabled_.load(std::memory_order_relaxed)) {
+        return;
+    }
+    
+    // Sayaç önce artırılır; süren kontrol kaydını kendisi geri alır
+    saveEpoch_.fetch_add(1);
+    missingData_.remove(key);
+}
+
+std::chrono::seconds DataManager::getMissingDataTtl() const {
+    return missingDataEnabled_.load() ? missingData_.getDefaultTtl() : std::chrono::seconds(0);
+}
+
+void DataManager::setMissingDataTtl(std::chrono::seconds ttl) {
+    missingDataEnabled_ = ttl.count() > 0;
+    if (ttl.count() > 0) {
+        missingData_.setDefaultTtl(ttl);
+    }
+    
+    missingData_.clear();
 }
 
 std::string DataManager::getDataDirectory() const {
@@ -75,11 +204,19 @@ std::string DataManager::getDataDirectory() const {
 }
 
 void DataManager::setDataDirectory(const std::string& directory) {
-    std::lock_guard<std::mutex> lock(directoryMutex_);
-    dataDirectory_ = directory;
+    {
+        std::lock_guard<std::mutex> lock(directoryMutex_);
+        dataDirectory_ = directory;
+    }
     
-    // Veri dizinini oluştur
+    // Veri dizinini oluştur (kendi kilidini alır)
     createDataDirectory();
+    
+    // Önbellek anlık görüntü yolunu güncelle
+    cache_.setSnapshotPath(createCacheSnapshotPath());
+    
+    // Eksik veri kayıtları eski dizine aittir
+    missingData_.clear();
 }
 
 std::string DataManager::getDataExtension() const {
@@ -88,19 +225,47 @@ std::string DataManager::getDataExtension() const {
 }
 
 void DataManager::setDataExtension(const std::string& extension) {
-    std::lock_guard<std::mutex> lock(directoryMutex_);
-    dataExtension_ = extension;
+    {
+        std::lock_guard<std::mutex> lock(directoryMutex_);
+        dataExtension_ = extension;
+    }
+    
+    // Eksik veri kayıtları eski uzantıya aittir
+    missingData_.clear();
 }
 
-std::string DataManager::createDataPath(const std::string& key) const {
+std::string DataManager::createDataPath(std::string_view key) const {
     std::lock_guard<std::mutex> lock(directoryMutex_);
     
-    // Veri yolunu oluştur
-    std::string filePath = dataDirectory_ + "/" + key + dataExtension_;
+    // Veri yolunu tek ayırmayla oluştur
+    std::string filePath;
+    filePath.reserve(dataDirectory_.size() + 1 + key.size() + dataExtension_.size());
+    filePath.append(dataDirectory_).append("/").append(key.data(), key.size()).append(dataExtension_);
     
     return filePath;
 }
 
+std::string DataManager::createCacheSnapshotPath() const {
+    std::lock_guard<std::mutex> lock(directoryMutex_);
+    return dataDirectory_ + "/cache.snapshot";
+}
+
+size_t DataManager::saveCacheSnapshot() {
+    return cache_.saveSnapshot(createCacheSnapshotPath());
+}
+
+size_t DataManager::loadCacheSnapshot() {
+    return cache_.loadSnapshot(createCacheSnapshotPath());
+}
+
+bool DataManager::enableCacheSpill(size_t byteBudget) {
+    return cache_.enableSpill(getDataDirectory() + "/cache.spill", byteBudget);
+}
+
+bool DataManager::enableCacheSharedSegment(const std::string& name) {
+    return cache_.enableSharedSegment(name);
+}
+
 std::string DataManager::generateDataReport() const {
     std::stringstream ss;
     
@@ -120,6 +285,22 @@ std::string DataManager::generateDataReport() const {
     
     ss << "  Size: " << cache_.size() << std::endl;
     ss << "  Capacity: " << cache_.capacity() << std::endl;
+    ss << "  Memory Usage: " << stats["bytes"] << " bytes" << std::endl;
+    if (stats["memoryBudget"] > 0) {
+        ss << "  Memory Budget: " << stats["memoryBudget"] << " bytes" << std::endl;
+    } else {
+        ss << "  Memory Budget: Unlimited" << std::endl;
+    }
+    ss << "  Average Entry Size: " << stats["averageEntryBytes"] << " bytes" << std::endl;
+    if (stats["compressionThreshold"] > 0) {
+        ss << "  Compression Threshold: " << stats["compressionThreshold"] << " bytes" << std::endl;
+        ss << "  Compressed Entries: " << stats["compressedEntries"] << " (" << stats["compressedBytes"]
+           << " bytes, uncompressed " << stats["uncompressedBytes"] << " bytes)" << std::endl;
+    } else {
+        ss << "  Compression: Disabled" << std::endl;
+    }
+    ss << "  Entry Allocations: " << stats["entryAllocated"] << " (reused " << stats["entryReused"]
+       << ", pooled " << stats["freeNodes"] << ")" << std::endl;
     ss << "  Default TTL: " << cache_.getDefaultTtl().count() << " seconds" << std::endl;
     ss << "  Cleanup Interval: " << cache_.getCleanupInterval().count() << " seconds" << std::endl;
     ss << "  Auto Cleanup: " << (cache_.isAutoCleanupRunning() ? "Running" : "Stopped") << std::endl;
@@ -127,6 +308,7 @@ std::string DataManager::generateDataReport() const {
     
     ss << "  Hits: " << stats["hit"] << std::endl;
     ss << "  Misses: " << stats["miss"] << std::endl;
+    ss << "  Front Cache Hits: " << stats["frontHit"] << std::endl;
     ss << "  Sets: " << stats["set"] << std::endl;
     ss << "  Removes: " << stats["remove"] << std::endl;
     ss << "  Clears: " << stats["clear"] << std::endl;
@@ -134,6 +316,82 @@ std::string DataManager::generateDataReport() const {
     ss << "  Clear By Tags: " << stats["clearByTags"] << std::endl;
     ss << "  Expired: " << stats["expired"] << std::endl;
     ss << "  Errors: " << stats["error"] << std::endl;
+    ss << "  Admission Rejected: " << stats["admissionRejected"] << std::endl;
+    ss << "  Loads: " << stats["load"] << std::endl;
+    ss << "  Loads Saved: " << stats["loadSaved"] << std::endl;
+    ss << "  Stale Hits: " << stats["staleHit"] << std::endl;
+    ss << "  Refreshes: " << stats["refresh"] << std::endl;
+    ss << "  Refresh Errors: " << stats["refreshError"] << std::endl;
+    ss << "  Listener Events Dropped: " << stats["listenerDropped"] << std::endl;
+    ss << "  Snapshot Entries Saved: " << stats["snapshotSaved"] << std::endl;
+    ss << "  Snapshot Entries Loaded: " << stats["snapshotLoaded"] << std::endl;
+    ss << "  Snapshot Load Time: " << stats["snapshotLoadMicros"] << " us" << std::endl;
+    if (stats["warmupMillis"] > 0) {
+        ss << "  Warm-up Time: " << stats["warmupMillis"] << " ms" << std::endl;
+    } else {
+        ss << "  Warm-up Time: Not reached" << std::endl;
+    }
+    if (cache_.isSpillEnabled()) {
+        ss << "  Spill Entries: " << stats["spillEntries"] << std::endl;
+        ss << "  Spill Size: " << stats["spillBytes"] << " bytes (file " << stats["spillFileBytes"] << " bytes)" << std::endl;
+        ss << "  Spill Writes: " << stats["spillWrite"] << std::endl;
+        ss << "  Spill Hits: " << stats["spillHit"] << std::endl;
+        ss << "  Spill Compactions: " << stats["spillCompactions"] << std::endl;
+    }
+    if (cache_.isSharedSegmentEnabled()) {
+        ss << "  Shared Entries: " << stats["sharedEntries"] << " / " << stats["sharedSlots"] << " slots" << std::endl;
+        ss << "  Shared Writes: " << stats["sharedWrite"] << std::endl;
+        ss << "  Shared Hits: " << stats["sharedHit"] << std::endl;
+    }
+    
+    // Eksik veri önbelleği
+    if (missingDataEnabled_.load()) {
+        auto missingStats = missingData_.getStats();
+        ss << "  Missing Data Entries: " << missingData_.size() << " (TTL " << missingData_.getDefaultTtl().count() << " seconds)" << std::endl;
+        ss << "  Missing Data Hits: " << missingStats["hit"] << std::endl;
+        ss << "  Missing Data Misses: " << missingStats["miss"] << std::endl;
+    } else {
+        ss << "  Missing Data Cache: Disabled" << std::endl;
+    }
+    
+    // Adlandırılmış önbellek örneklerinin istatistikleri
+    auto& registry = CacheRegistry::getInstance();
+    auto names = registry.getNames();
+    if (!names.empty()) {
+        ss << std::endl;
+        ss << "Cache Instances:" << std::endl;
+        
+        for (const auto& name : names) {
+            auto instance = registry.get(name);
+            if (!instance) {
+                continue;
+            }
+            
+            auto instanceStats = instance->getStats();
+            
+            ss << "  " << name << ": Size " << instance->size()
+               << ", Capacity " << instance->capacity()
+               << ", Hits " << instanceStats["hit"]
+               << ", Misses " << instanceStats["miss"]
+               << ", Memory " << instanceStats["bytes"] << " bytes" << std::endl;
+        }
+    }
+    
+    // Tür güvenli önbellek istatistikleri
+    std::lock_guard<std::mutex> lock(typedCachesMutex_);
+    if (!typedCaches_.empty()) {
+        ss << std::endl;
+        ss << "Typed Caches:" << std::endl;
+        
+        for (const auto& pair : typedCaches_) {
+            auto typedStats = pair.second.stats();
+            
+            ss << "  " << pair.first << ": Size " << pair.second.size()
+               << ", Hits " << typedStats["hit"]
+               << ", Misses " << typedStats["miss"]
+               << ", Memory " << typedStats["bytes"] << " bytes" << std::endl;
+        }
+    }
     
     return ss.str();
 }
@@ -158,6 +416,43 @@ bool DataManager::saveDataReport(const std::string& filePath) const {
     return true;
 }
 
+bool DataManager::startReportFlush(const std::string& filePath, std::chrono::seconds interval) {
+    if (interval.count() <= 0) {
+        return false;
+    }
+    
+    MaintenanceScheduler& scheduler = MaintenanceScheduler::getInstance();
+    MaintenanceScheduler::TaskId previous;
+    {
+        std::lock_guard<std::mutex> lock(reportMutex_);
+        previous = reportTask_;
+        reportTask_ = scheduler.scheduleEvery([this, filePath]() {
+            saveDataReport(filePath);
+        }, interval, interval);
+    }
+    
+    // Önceki görevi iptal et
+    if (previous != 0) {
+        scheduler.cancel(previous);
+    }
+    
+    return true;
+}
+
+void DataManager::stopReportFlush() {
+    MaintenanceScheduler::TaskId task;
+    {
+        std::lock_guard<std::mutex> lock(reportMutex_);
+        task = reportTask_;
+        reportTask_ = 0;
+    }
+    
+    // Görevi iptal et; çalışan kaydın bitmesi beklenir
+    if (task != 0) {
+        MaintenanceScheduler::getInstance().cancel(task);
+    }
+}
+
 void DataManager::printDataReport() const {
     // Raporu oluştur
     std::string report = generateDataReport();
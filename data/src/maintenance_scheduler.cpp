@@ -0,0 +1,267 @@
+#include "data/maintenance_scheduler.h"
+#include <iostream>
+#include <algorithm>
+
+namespace alt_las {
+namespace data {
+
+MaintenanceScheduler& MaintenanceScheduler::getInstance() {
+    static MaintenanceScheduler instance;
+    return instance;
+}
+
+MaintenanceScheduler::MaintenanceScheduler()
+    : nextId_(1),
+      nextSequence_(0),
+      runningId_(0),
+      running_(false),
+      stopping_(false) {
+}
+
+MaintenanceScheduler::~MaintenanceScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    condition_.notify_all();
+    workAvailable_.notify_all();
+
+    // Çalışan görevler bittikten sonra iş parçacıkları çıkar
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+MaintenanceScheduler::TaskId MaintenanceScheduler::schedule(std::function<void()> task, Clock::duration delay) {
+    return scheduleEvery(std::move(task), Clock::duration::zero(), delay);
+}
+
+MaintenanceScheduler::TaskId MaintenanceScheduler::scheduleEvery(std::function<void()> task, Clock::duration interval, Clock::duration delay) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    TaskId id = nextId_++;
+    Task& entry = tasks_[id];
+    entry.function = std::make_shared<std::function<void()>>(std::move(task));
+    entry.interval = interval;
+    entry.pooled = false;
+    push(id, entry, Clock::now() + delay);
+
+    // İş parçacığını ilk görevle başlat
+    if (!running_) {
+        running_ = true;
+        thread_ = std::thread(&MaintenanceScheduler::run, this);
+    }
+
+    return id;
+}
+
+MaintenanceScheduler::TaskId MaintenanceScheduler::submit(std::function<void()> task) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    TaskId id = nextId_++;
+    Task& entry = tasks_[id];
+    entry.function = std::make_shared<std::function<void()>>(std::move(task));
+    entry.interval = Clock::duration::zero();
+    entry.sequence = 0;
+    entry.pooled = true;
+    ready_.push_back(id);
+
+    // İş havuzunu ilk görevle başlat
+    if (workers_.empty()) {
+        for (size_t i = 0; i < kWorkerCount; i++) {
+            workers_.emplace_back(&MaintenanceScheduler::runWorker, this);
+        }
+    }
+
+    workAvailable_.notify_one();
+
+    return id;
+}
+
+bool MaintenanceScheduler::reschedule(TaskId id, Clock::duration interval) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = tasks_.find(id);
+    if (it == tasks_.end() || it->second.pooled) {
+        return false;
+    }
+
+    if (it->second.interval != Clock::duration::zero()) {
+        it->second.interval = interval;
+    }
+    push(id, it->second, Clock::now() + interval);
+
+    return true;
+}
+
+bool MaintenanceScheduler::cancel(TaskId id) {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    auto it = tasks_.find(id);
+    bool found = it != tasks_.end();
+    if (found && it->second.pooled) {
+        ready_.erase(std::remove(ready_.begin(), ready_.end(), id), ready_.end());
+    }
+    if (found) {
+        tasks_.erase(it);
+    }
+
+    // Görev başka bir iş parçacığında çalışıyorsa bitmesini bekle
+    if (isRunningElsewhere(id)) {
+        found = true;
+        finished_.wait(lock, [this, id]() {
+            return !isRunningElsewhere(id);
+        });
+    }
+
+    // İptal edilmiş kayıtlar birikmişse kuyruğu yeniden kur
+    if (queue_.size() > 2 * tasks_.size() + 64) {
+        std::vector<QueueItem> items;
+        items.reserve(tasks_.size());
+        while (!queue_.empty()) {
+            auto task = tasks_.find(queue_.top().id);
+            if (task != tasks_.end() && task->second.sequence == queue_.top().sequence) {
+                items.push_back(queue_.top());
+            }
+            queue_.pop();
+        }
+        for (const auto& item : items) {
+            queue_.push(item);
+        }
+    }
+
+    return found;
+}
+
+bool MaintenanceScheduler::isScheduled(TaskId id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return tasks_.find(id) != tasks_.end();
+}
+
+size_t MaintenanceScheduler::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return tasks_.size();
+}
+
+bool MaintenanceScheduler::isRunningElsewhere(TaskId id) const {
+    std::thread::id self = std::this_thread::get_id();
+    if (runningId_ == id && self != thread_.get_id()) {
+        return true;
+    }
+
+    return std::any_of(workerRunning_.begin(), workerRunning_.end(), [id, self](const auto& pair) {
+        return pair.first == id && pair.second != self;
+    });
+}
+
+void MaintenanceScheduler::push(TaskId id, Task& task, Clock::time_point due) {
+    task.sequence = nextSequence_++;
+    queue_.push(QueueItem{due, task.sequence, id});
+
+    // Yeni görev en yakınsa bekleyen iş parçacığını uyandır
+    if (queue_.top().id == id) {
+        condition_.notify_one();
+    }
+}
+
+void MaintenanceScheduler::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (!stopping_) {
+        if (queue_.empty()) {
+            condition_.wait(lock);
+            continue;
+        }
+
+        // Yeniden zamanlanmış veya iptal edilmiş görevlerin eski kayıtlarını atla
+        QueueItem item = queue_.top();
+        auto it = tasks_.find(item.id);
+        if (it == tasks_.end() || it->second.sequence != item.sequence) {
+            queue_.pop();
+            continue;
+        }
+
+        // En yakın görevin zamanına kadar veya yeni görev gelene kadar bekle
+        if (item.due > Clock::now()) {
+            condition_.wait_until(lock, item.due);
+            continue;
+        }
+
+        queue_.pop();
+        auto function = it->second.function;
+        bool periodic = it->second.interval != Clock::duration::zero();
+        if (!periodic) {
+            tasks_.erase(it);
+        }
+
+        // Görevi kilit dışında çalıştır
+        runningId_ = item.id;
+        lock.unlock();
+
+        try {
+            (*function)();
+        } catch (const std::exception& e) {
+            std::cerr << "Failed to run maintenance task: " << e.what() << std::endl;
+        } catch (...) {
+            std::cerr << "Failed to run maintenance task: unknown error" << std::endl;
+        }
+
+        lock.lock();
+        runningId_ = 0;
+        finished_.notify_all();
+
+        // Çalışırken iptal edilmemiş veya yeniden zamanlanmamış periyodik görevi yeniden kuyruğa ekle
+        it = tasks_.find(item.id);
+        if (periodic && it != tasks_.end() && it->second.sequence == item.sequence) {
+            push(item.id, it->second, Clock::now() + it->second.interval);
+        }
+    }
+}
+
+void MaintenanceScheduler::runWorker() {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true) {
+        workAvailable_.wait(lock, [this]() {
+            return stopping_ || !ready_.empty();
+        });
+
+        // Bekleyen görevler çalıştırılmaz
+        if (stopping_) {
+            break;
+        }
+
+        // İptal edilmiş görevleri atla
+        TaskId id = ready_.front();
+        ready_.pop_front();
+        auto it = tasks_.find(id);
+        if (it == tasks_.end()) {
+            continue;
+        }
+
+        auto function = it->second.function;
+        tasks_.erase(it);
+
+        // Görevi kilit dışında çalıştır
+        workerRunning_.emplace_back(id, std::this_thread::get_id());
+        lock.unlock();
+
+        try {
+            (*function)();
+        } catch (const std::exception& e) {
+            std::cerr << "Failed to run maintenance task: " << e.what() << std::endl;
+        } catch (...) {
+            std::cerr << "Failed to run maintenance task: unknown error" << std::endl;
+        }
+
+        lock.lock();
+        workerRunning_.erase(std::find(workerRunning_.begin(), workerRunning_.end(), std::make_pair(id, std::this_thread::get_id())));
+        finished_.notify_all();
+    }
+}
+
+} // namespace data
+} // namespace alt_las
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include "data/cache_compression.h"
+#include <random>
+#include <string>
+
+namespace alt_las {
+namespace data {
+namespace {
+
+/**
+ * @brief Girdiyi sıkıştırıp açar ve özgün veriyle karşılaştırır
+ *
+ * @param input Girdi
+ */
+void expectRoundTrip(const std::string& input) {
+    std::string compressed = compressCacheBytes(input);
+    std::string output;
+    ASSERT_TRUE(decompressCacheBytes(compressed, input.size(), output)) << "size " << input.size();
+    EXPECT_EQ(output, input) << "size " << input.size();
+}
+
+/**
+ * @brief Tekrarlanabilir rastgele baytlar üretir
+ *
+ * @param size Boyut
+ * @param seed Tohum
+ * @return Baytlar
+ */
+std::string randomBytes(size_t size, unsigned seed) {
+    std::mt19937 generator(seed);
+    std::string bytes(size, '\0');
+    for (auto& byte : bytes) {
+        byte = static_cast<char>(generator() & 0xff);
+    }
+    return bytes;
+}
+
+TEST(CacheCompressionTest, ShortInputsRoundTrip) {
+    // En küçük eşleşmeden kısa girdiler yalnızca değişmez baytlardan oluşur
+    for (size_t size = 0; size <= 16; size++) {
+        expectRoundTrip(std::string(size, 'a'));
+        expectRoundTrip(randomBytes(size, static_cast<unsigned>(size)));
+    }
+}
+
+TEST(CacheCompressionTest, LengthExtensionBoundariesRoundTrip) {
+    // Belirteçteki 4 bitlik alanı ve 255'lik ek baytları aşan uzunluklar
+    for (size_t size : {14u, 15u, 16u, 18u, 19u, 20u, 254u, 255u, 256u, 269u, 270u, 271u, 524u, 525u, 526u, 4096u}) {
+        expectRoundTrip(std::string(size, 'z'));
+        expectRoundTrip(randomBytes(size, static_cast<unsigned>(size)));
+        expectRoundTrip(randomBytes(size, 1) + std::string(size, 'q') + randomBytes(size, 2));
+    }
+}
+
+TEST(CacheCompressionTest, OverlappingMatchesRoundTrip) {
+    // Uzaklığı eşleşme uzunluğundan kısa olan eşleşmeler bayt bayt kopyalanır
+    expectRoundTrip(std::string(100000, 'x'));
+    expectRoundTrip(std::string("ab") + std::string(1000, 'c') + "abababababababababab");
+
+    std::string pattern;
+    for (int i = 0; i < 5000; i++) {
+        pattern += "xyz";
+    }
+    expectRoundTrip(pattern);
+}
+
+TEST(CacheCompressionTest, RepetitiveDataShrinks) {
+    std::string input;
+    for (int i = 0; i < 1000; i++) {
+        input += "{\"id\":" + std::to_string(i % 10) + ",\"name\":\"value\"}";
+    }
+
+    EXPECT_LT(compressCacheBytes(input).size(), input.size() / 4);
+    expectRoundTrip(input);
+}
+
+TEST(CacheCompressionTest, DataBeyondWindowRoundTrips) {
+    // 64 KiB pencerenin dışındaki tekrarlar eşleşme olarak kullanılmaz
+    std::string block = randomBytes(40000, 7);
+    expectRoundTrip(block + randomBytes(40000, 8) + block);
+    expectRoundTrip(randomBytes(200000, 9));
+}
+
+TEST(CacheCompressionTest, CorruptInputIsRejected) {
+    std::string input;
+    for (int i = 0; i < 100; i++) {
+        input += "repeated text ";
+    }
+    std::string compressed = compressCacheBytes(input);
+    std::string output;
+
+    // Yanlış boyut
+    EXPECT_FALSE(decompressCacheBytes(compressed, input.size() + 1, output));
+    EXPECT_FALSE(decompressCacheBytes(compressed, input.size() - 1, output));
+
+    // Kesilmiş veri
+    EXPECT_FALSE(decompressCacheBytes(compressed.substr(0, compressed.size() / 2), input.size(), output));
+
+    // Dört değişmez bayt ve dört baytlık eşleşme
+    std::string valid("\x40" "abcd" "\x04\x00", 7);
+    ASSERT_TRUE(decompressCacheBytes(valid, 8, output));
+    EXPECT_EQ(output, "abcdabcd");
+
+    // Çıktının başından önceyi gösteren uzaklık
+    std::string badOffset("\x40" "abcd" "\xff\x00", 7);
+    EXPECT_FALSE(decompressCacheBytes(badOffset, 8, output));
+
+    // Sıfır uzaklık
+    std::string zeroOffset("\x40" "abcd" "\x00\x00", 7);
+    EXPECT_FALSE(decompressCacheBytes(zeroOffset, 8, output));
+}
+
+} // namespace
+} // namespace data
+} // namespace alt_las
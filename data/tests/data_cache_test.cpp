@@ -0,0 +1,590 @@
+#include <gtest/gtest.h>
+#include "data/cache_registry.h"
+#include "data/data_cache.h"
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace alt_las {
+namespace data {
+namespace {
+
+/**
+ * @brief Her test için ayrı bir önbellek örneği oluşturan fikstür
+ */
+class DataCacheTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        cache_.reset();
+        peer_.reset();
+        CacheRegistry::getInstance().remove(name_);
+        CacheRegistry::getInstance().remove(name_ + ".peer");
+        for (const auto& path : paths_) {
+            std::remove(path.c_str());
+        }
+    }
+
+    /**
+     * @brief Testin adıyla önbellek örneği oluşturur
+     *
+     * @param config Yapılandırma
+     * @return Önbellek
+     */
+    DataCache& createCache(const CacheConfig& config) {
+        name_ = std::string("test.") + ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        cache_ = CacheRegistry::getInstance().create(name_, config);
+        return *cache_;
+    }
+
+    /**
+     * @brief İkinci bir önbellek örneği oluşturur
+     *
+     * @param config Yapılandırma
+     * @return Önbellek
+     */
+    DataCache& createPeer(const CacheConfig& config) {
+        peer_ = CacheRegistry::getInstance().create(name_ + ".peer", config);
+        return *peer_;
+    }
+
+    /**
+     * @brief Test sonunda silinecek geçici dosya yolu döndürür
+     *
+     * @param suffix Dosya adı eki
+     * @return Dosya yolu
+     */
+    std::string tempPath(const std::string& suffix) {
+        std::string path = (std::filesystem::temp_directory_path() / ("alt_las_" + name_ + suffix)).string();
+        paths_.push_back(path);
+        return path;
+    }
+
+    std::string name_;
+    std::shared_ptr<DataCache> cache_;
+    std::shared_ptr<DataCache> peer_;
+    std::vector<std::string> paths_;
+};
+
+TEST_F(DataCacheTest, ShardCountIsRoundedToPowerOfTwo) {
+    CacheConfig config;
+    config.shardCount = 5;
+    DataCache& cache = createCache(config);
+
+    EXPECT_EQ(cache.getShardCount(), 8u);
+
+    cache.setShardCount(3);
+    EXPECT_EQ(cache.getShardCount(), 4u);
+
+    cache.setShardCount(100000);
+    EXPECT_EQ(cache.getShardCount(), DataCache::kMaxShardCount);
+}
+
+TEST_F(DataCacheTest, ShardedCacheKeepsEveryKey) {
+    CacheConfig config;
+    config.capacity = 10000;
+    config.shardCount = 16;
+    DataCache& cache = createCache(config);
+
+    for (int i = 0; i < 1000; i++) {
+        cache.set("key" + std::to_string(i), i);
+    }
+
+    EXPECT_EQ(cache.size(), 1000u);
+    for (int i = 0; i < 1000; i++) {
+        EXPECT_EQ(cache.get<int>("key" + std::to_string(i), -1), i);
+    }
+}
+
+TEST_F(DataCacheTest, ResizingShardsKeepsEntries) {
+    CacheConfig config;
+    config.capacity = 10000;
+    config.shardCount = 4;
+    DataCache& cache = createCache(config);
+
+    for (int i = 0; i < 500; i++) {
+        cache.set("key" + std::to_string(i), i, std::chrono::seconds(0), i % 2 ? "odd" : "even");
+    }
+
+    // Girdiler, etiketler ve sona erme kayıtları yeni parçalara taşınır
+    cache.setShardCount(32);
+    EXPECT_EQ(cache.size(), 500u);
+    EXPECT_EQ(cache.get<int>("key123", -1), 123);
+
+    cache.setShardCount(1);
+    EXPECT_EQ(cache.size(), 500u);
+    EXPECT_EQ(cache.clearByTags("odd"), 250u);
+    EXPECT_EQ(cache.get<int>("key124", -1), 124);
+}
+
+TEST_F(DataCacheTest, ConcurrentWritersOnDifferentShards) {
+    CacheConfig config;
+    config.capacity = 100000;
+    config.shardCount = 16;
+    DataCache& cache = createCache(config);
+
+    const int threadCount = 4;
+    const int keysPerThread = 2000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+        threads.emplace_back([&cache, t]() {
+            for (int i = 0; i < keysPerThread; i++) {
+                std::string key = std::to_string(t) + ":" + std::to_string(i);
+                cache.set(key, i);
+                cache.get<int>(key);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(cache.size(), static_cast<size_t>(threadCount * keysPerThread));
+    EXPECT_EQ(cache.get<int>("3:1999", -1), 1999);
+}
+
+TEST_F(DataCacheTest, ManyKeyOperationsMatchSingleKeyOperations) {
+    CacheConfig config;
+    config.shardCount = 8;
+    DataCache& cache = createCache(config);
+
+    std::vector<std::pair<std::string, int>> items;
+    for (int i = 0; i < 50; i++) {
+        items.emplace_back("key" + std::to_string(i), i);
+    }
+    cache.setMany(items);
+
+    std::vector<std::string> keys = {"key1", "missing", "key49"};
+    auto values = cache.getMany<int>(keys);
+    ASSERT_EQ(values.size(), 3u);
+    EXPECT_EQ(values[0], 1);
+    EXPECT_FALSE(values[1].has_value());
+    EXPECT_EQ(values[2], 49);
+
+    EXPECT_EQ(cache.removeMany(keys), 2u);
+    EXPECT_EQ(cache.size(), 48u);
+}
+
+/**
+ * @brief Üç girdilik önbelleğe a, b, c yazar, a'yı okur ve d'yi ekler
+ *
+ * @param cache Önbellek
+ * @return Tahliye edilen anahtar, yoksa boş dizge
+ */
+std::string evictAfterTouchingFirst(DataCache& cache) {
+    cache.set("a", 1);
+    cache.set("b", 2);
+    cache.set("c", 3);
+    cache.get<int>("a");
+    cache.set("d", 4);
+
+    std::string evicted;
+    for (const char* key : {"a", "b", "c", "d"}) {
+        if (!cache.has(key)) {
+            evicted += key;
+        }
+    }
+    return evicted;
+}
+
+TEST_F(DataCacheTest, LruEvictsLeastRecentlyUsed) {
+    CacheConfig config;
+    config.capacity = 3;
+    config.evictionPolicy = EvictionPolicy::LRU;
+    DataCache& cache = createCache(config);
+
+    EXPECT_EQ(evictAfterTouchingFirst(cache), "b");
+}
+
+TEST_F(DataCacheTest, FifoEvictsOldestInsertion) {
+    CacheConfig config;
+    config.capacity = 3;
+    config.evictionPolicy = EvictionPolicy::FIFO;
+    DataCache& cache = createCache(config);
+
+    EXPECT_EQ(evictAfterTouchingFirst(cache), "a");
+}
+
+TEST_F(DataCacheTest, ClockGivesReferencedEntrySecondChance) {
+    CacheConfig config;
+    config.capacity = 3;
+    config.evictionPolicy = EvictionPolicy::CLOCK;
+    DataCache& cache = createCache(config);
+
+    // İbre a'da durur; a okunduğu için atlanır ve b tahliye edilir
+    EXPECT_EQ(evictAfterTouchingFirst(cache), "b");
+
+    // Atlanan a'nın biti temizlendi; okunmadıkça bir sonraki kurban odur
+    cache.set("e", 5);
+    EXPECT_FALSE(cache.has("c"));
+    EXPECT_TRUE(cache.has("a"));
+}
+
+TEST_F(DataCacheTest, PolicyChangeKeepsEntries) {
+    CacheConfig config;
+    config.capacity = 3;
+    DataCache& cache = createCache(config);
+
+    cache.set("a", 1);
+    cache.set("b", 2);
+    cache.set("c", 3);
+    cache.setEvictionPolicy(EvictionPolicy::FIFO);
+    cache.get<int>("a");
+    cache.set("d", 4);
+
+    EXPECT_EQ(cache.getEvictionPolicy(), EvictionPolicy::FIFO);
+    EXPECT_FALSE(cache.has("a"));
+    EXPECT_EQ(cache.size(), 3u);
+}
+
+TEST_F(DataCacheTest, ClearExpiredRemovesEntriesInSlices) {
+    CacheConfig config;
+    config.capacity = 10000;
+    DataCache& cache = createCache(config);
+
+    // Bir parçada dilim boyutunun birkaç katı kadar süresi dolacak girdi
+    const int shortCount = static_cast<int>(DataCache::kExpirySliceSize) * 4;
+    for (int i = 0; i < shortCount; i++) {
+        cache.set("short" + std::to_string(i), i, std::chrono::seconds(1));
+    }
+    for (int i = 0; i < 100; i++) {
+        cache.set("long" + std::to_string(i), i, std::chrono::seconds(3600));
+    }
+
+    // Yeniden yazılan girdilerin eski sona erme kayıtları atlanır
+    for (int i = 0; i < 10; i++) {
+        cache.set("short" + std::to_string(i), i, std::chrono::seconds(3600));
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+
+    // Süresi dolmuş girdi temizlenmeden de okunamaz
+    EXPECT_FALSE(cache.has("short10"));
+    EXPECT_EQ(cache.get<int>("short11", -1), -1);
+
+    EXPECT_EQ(cache.clearExpired(), static_cast<size_t>(shortCount - 12));
+    EXPECT_EQ(cache.size(), 110u);
+    EXPECT_EQ(cache.clearExpired(), 0u);
+    EXPECT_EQ(cache.get<int>("short5", -1), 5);
+}
+
+TEST_F(DataCacheTest, ClearByTagsRemovesEntriesCarryingAllTags) {
+    CacheConfig config;
+    config.capacity = 1000;
+    config.shardCount = 4;
+    DataCache& cache = createCache(config);
+
+    cache.set("user1", 1, std::chrono::seconds(0), "user,active");
+    cache.set("user2", 2, std::chrono::seconds(0), "user");
+    cache.set("user3", 3, std::chrono::seconds(0), "active user");
+    cache.set("order1", 4, std::chrono::seconds(0), "order;active");
+
+    // Etiketin tamamı, ayırıcı biçiminden bağımsız olarak eşleşir
+    EXPECT_EQ(cache.clearByTags("active,user"), 2u);
+    EXPECT_FALSE(cache.has("user1"));
+    EXPECT_FALSE(cache.has("user3"));
+    EXPECT_TRUE(cache.has("user2"));
+    EXPECT_TRUE(cache.has("order1"));
+
+    // Etiket öneki eşleşme sayılmaz
+    EXPECT_EQ(cache.clearByTags("ord"), 0u);
+    EXPECT_EQ(cache.clearByTags(""), 0u);
+
+    EXPECT_EQ(cache.getKeysByTag("active"), std::vector<std::string>{"order1"});
+    EXPECT_EQ(cache.clearByTags("active"), 1u);
+    EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST_F(DataCacheTest, RewriteReplacesTags) {
+    DataCache& cache = createCache(CacheConfig());
+
+    cache.set("key", 1, std::chrono::seconds(0), "old");
+    cache.set("key", 2, std::chrono::seconds(0), "new");
+
+    EXPECT_TRUE(cache.getKeysByTag("old").empty());
+    EXPECT_EQ(cache.clearByTags("old"), 0u);
+    EXPECT_EQ(cache.clearByTags("new"), 1u);
+    EXPECT_FALSE(cache.has("key"));
+}
+
+TEST_F(DataCacheTest, MemoryBudgetEvictsByBytes) {
+    CacheConfig config;
+    config.capacity = 1000;
+    config.memoryBudget = 1000;
+    DataCache& cache = createCache(config);
+
+    // Girdi boyutu, verilen değer boyutu ile anahtar uzunluğunun toplamıdır
+    for (int i = 0; i < 20; i++) {
+        cache.set("k" + std::to_string(i % 10) + std::to_string(i / 10), i, std::chrono::seconds(0), "", 97);
+    }
+
+    EXPECT_LE(cache.memoryUsage(), 1000u);
+    EXPECT_EQ(cache.size(), 10u);
+    EXPECT_EQ(cache.memoryUsage(), 1000u);
+    EXPECT_FALSE(cache.has("k00"));
+    EXPECT_TRUE(cache.has("k91"));
+
+    // Bütçe küçülünce en eski girdiler hemen tahliye edilir
+    cache.setMemoryBudget(300);
+    EXPECT_EQ(cache.size(), 3u);
+    EXPECT_TRUE(cache.has("k91"));
+
+    // Bütçe kaldırılınca yalnızca girdi kapasitesi sınırlar
+    cache.setMemoryBudget(0);
+    for (int i = 0; i < 50; i++) {
+        cache.set("big" + std::to_string(i), i, std::chrono::seconds(0), "", 10000);
+    }
+    EXPECT_EQ(cache.size(), 53u);
+}
+
+TEST_F(DataCacheTest, RemovalAndRewriteUpdateByteUsage) {
+    DataCache& cache = createCache(CacheConfig());
+
+    cache.set("a", 1, std::chrono::seconds(0), "", 99);
+    cache.set("b", 2, std::chrono::seconds(0), "", 199);
+    EXPECT_EQ(cache.memoryUsage(), 300u);
+
+    cache.set("a", 3, std::chrono::seconds(0), "", 49);
+    EXPECT_EQ(cache.memoryUsage(), 250u);
+
+    cache.remove("b");
+    EXPECT_EQ(cache.memoryUsage(), 50u);
+
+    cache.clear();
+    EXPECT_EQ(cache.memoryUsage(), 0u);
+}
+
+TEST_F(DataCacheTest, GetOrComputeCallsLoaderOncePerMiss) {
+    DataCache& cache = createCache(CacheConfig());
+
+    std::atomic<int> calls(0);
+    auto loader = [&calls]() {
+        calls++;
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        return 42;
+    };
+
+    // Yükleme sürerken gelen çağıranlar aynı sonucu bekler
+    std::vector<int> results(4, 0);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < results.size(); i++) {
+        threads.emplace_back([&cache, &loader, &results, i]() {
+            results[i] = cache.getOrCompute<int>("key", loader);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(calls.load(), 1);
+    EXPECT_EQ(results, std::vector<int>(4, 42));
+
+    auto stats = cache.getStats();
+    EXPECT_EQ(stats["load"], 1u);
+    EXPECT_EQ(stats["loadSaved"], 3u);
+
+    // Önbellekteki değer yükleyici çağrılmadan döner
+    EXPECT_EQ(cache.getOrCompute<int>("key", loader), 42);
+    EXPECT_EQ(calls.load(), 1);
+}
+
+TEST_F(DataCacheTest, GetOrComputePropagatesLoaderFailure) {
+    DataCache& cache = createCache(CacheConfig());
+
+    auto failing = []() -> int {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        throw std::runtime_error("load failed");
+    };
+
+    std::atomic<int> failures(0);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 3; i++) {
+        threads.emplace_back([&cache, &failing, &failures]() {
+            try {
+                cache.getOrCompute<int>("key", failing);
+            } catch (const std::runtime_error&) {
+                failures++;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(failures.load(), 3);
+    EXPECT_FALSE(cache.has("key"));
+
+    // Başarısız yükleme kaydı kalmaz; sonraki çağrı yeniden yükler
+    EXPECT_EQ(cache.getOrCompute<int>("key", []() { return 7; }), 7);
+}
+
+TEST_F(DataCacheTest, GetOrComputeRejectsRecursiveLoad) {
+    DataCache& cache = createCache(CacheConfig());
+
+    auto recursive = [&cache]() {
+        return cache.getOrCompute<int>("key", []() { return 1; });
+    };
+
+    EXPECT_THROW(cache.getOrCompute<int>("key", recursive), std::logic_error);
+    EXPECT_FALSE(cache.has("key"));
+    EXPECT_EQ(cache.getOrCompute<int>("key", []() { return 2; }), 2);
+}
+
+TEST_F(DataCacheTest, SnapshotRoundTripKeepsValuesTagsAndOrder) {
+    CacheConfig config;
+    config.capacity = 4;
+    DataCache& cache = createCache(config);
+    cache.registerSnapshotType<std::string>("string");
+    cache.registerSnapshotType<int>("int");
+
+    cache.set("a", std::string("alpha"), std::chrono::seconds(3600), "letters");
+    cache.set("b", 2, std::chrono::seconds(0), "numbers");
+    cache.set("c", std::string(5000, 'c'), std::chrono::seconds(0), "letters,long");
+    cache.get<std::string>("a");
+    cache.get<int>("b");
+
+    // Kaydedilmemiş türdeki girdi atlanır
+    cache.set("skipped", 1.5);
+
+    std::string path = tempPath(".snap");
+    EXPECT_EQ(cache.saveSnapshot(path), 3u);
+
+    config.capacity = 3;
+    DataCache& peer = createPeer(config);
+    peer.registerSnapshotType<std::string>("string");
+    peer.registerSnapshotType<int>("int");
+    EXPECT_EQ(peer.loadSnapshot(path), 3u);
+
+    // Kullanım sırası korunur: yeni girdi en eski kullanılan c'yi tahliye eder
+    peer.set("d", 4);
+    EXPECT_FALSE(peer.has("c"));
+
+    EXPECT_EQ(peer.get<std::string>("a"), "alpha");
+    EXPECT_EQ(peer.get<int>("b", -1), 2);
+    EXPECT_EQ(peer.getKeysByTag("numbers"), std::vector<std::string>{"b"});
+    EXPECT_EQ(peer.clearByTags("letters"), 1u);
+}
+
+TEST_F(DataCacheTest, SnapshotLoadSkipsExpiredAndCorruptData) {
+    DataCache& cache = createCache(CacheConfig());
+    cache.registerSnapshotType<int>("int");
+
+    cache.set("short", 1, std::chrono::seconds(1));
+    cache.set("long", 2, std::chrono::seconds(3600));
+
+    std::string path = tempPath(".snap");
+    EXPECT_EQ(cache.saveSnapshot(path), 2u);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+
+    DataCache& peer = createPeer(CacheConfig());
+    peer.registerSnapshotType<int>("int");
+    EXPECT_EQ(peer.loadSnapshot(path), 1u);
+    EXPECT_FALSE(peer.has("short"));
+    EXPECT_EQ(peer.get<int>("long", -1), 2);
+
+    // Bozuk veya olmayan dosya önbelleği değiştirmez
+    std::string corrupt = tempPath(".corrupt");
+    std::ofstream(corrupt, std::ios::binary) << "not a snapshot";
+    EXPECT_EQ(peer.loadSnapshot(corrupt), 0u);
+    EXPECT_EQ(peer.loadSnapshot(tempPath(".missing")), 0u);
+    EXPECT_EQ(peer.size(), 1u);
+}
+
+TEST_F(DataCacheTest, SpillRoundTripPromotesEvictedEntries) {
+    CacheConfig config;
+    config.capacity = 10;
+    DataCache& cache = createCache(config);
+    cache.registerSnapshotType<std::string>("string");
+    ASSERT_TRUE(cache.enableSpill(tempPath(".spill"), 0));
+
+    for (int i = 0; i < 100; i++) {
+        cache.set("key" + std::to_string(i), std::string(100, 'a' + i % 26), std::chrono::seconds(3600), i % 2 ? "odd" : "even");
+    }
+
+    auto stats = cache.getStats();
+    EXPECT_EQ(cache.size(), 10u);
+    EXPECT_EQ(stats["spillEntries"], 90u);
+    EXPECT_EQ(stats["spillWrite"], 90u);
+
+    // Tahliye edilen girdi diskten belleğe geri alınır
+    EXPECT_TRUE(cache.has("key3"));
+    EXPECT_EQ(cache.get<std::string>("key3"), std::string(100, 'd'));
+    EXPECT_EQ(cache.getStats()["spillHit"], 1u);
+
+    // Silme ve yeniden yazma diskteki kaydı geçersiz kılar
+    EXPECT_TRUE(cache.remove("key5"));
+    EXPECT_FALSE(cache.has("key5"));
+    cache.set("key7", std::string("new"));
+    EXPECT_EQ(cache.get<std::string>("key7"), "new");
+
+    // Etiket temizliği diskteki kayıtlara da uygulanır
+    cache.clearByTags("odd");
+    EXPECT_FALSE(cache.has("key9"));
+    EXPECT_EQ(cache.get<std::string>("key8"), std::string(100, 'i'));
+
+    cache.disableSpill();
+    EXPECT_FALSE(cache.isSpillEnabled());
+    EXPECT_FALSE(cache.has("key10"));
+}
+
+TEST_F(DataCacheTest, SpillRespectsByteBudgetAndCompacts) {
+    CacheConfig config;
+    config.capacity = 10;
+    DataCache& cache = createCache(config);
+    cache.registerSnapshotType<std::string>("string");
+    ASSERT_TRUE(cache.enableSpill(tempPath(".spill"), 20000));
+
+    for (int i = 0; i < 1000; i++) {
+        cache.set("key" + std::to_string(i), std::string(100, 'x'));
+    }
+    EXPECT_LE(cache.getStats()["spillBytes"], 20000u);
+    EXPECT_TRUE(cache.has("key999"));
+    EXPECT_FALSE(cache.has("key0"));
+
+    // Sıkıştırma iş havuzunda eşzamansız çalışır
+    for (int round = 0; round < 20; round++) {
+        for (int i = 900; i < 1000; i++) {
+            cache.get<std::string>("key" + std::to_string(i));
+        }
+    }
+    for (int wait = 0; wait < 200 && cache.getStats()["spillCompactions"] == 0; wait++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_GT(cache.getStats()["spillCompactions"], 0u);
+
+    for (int i = 900; i < 1000; i++) {
+        EXPECT_EQ(cache.get<std::string>("key" + std::to_string(i)), std::string(100, 'x'));
+    }
+}
+
+TEST_F(DataCacheTest, CompressedValuesRoundTrip) {
+    DataCache& cache = createCache(CacheConfig());
+    cache.registerSnapshotType<std::string>("string");
+    cache.setCompressionThreshold(1024);
+
+    std::string large;
+    for (int i = 0; i < 1000; i++) {
+        large += "compressible text ";
+    }
+    cache.set("large", large);
+    cache.set("small", std::string("short"));
+    cache.set("empty", std::string());
+
+    // Sıkıştırılmış girdi daha az yer kaplar ve okunurken açılır
+    EXPECT_LT(cache.memoryUsage(), large.size() / 2);
+    EXPECT_EQ(cache.get<std::string>("large"), large);
+    EXPECT_EQ(cache.get<std::string>("small"), "short");
+    EXPECT_EQ(cache.get<std::string>("empty", "default"), "");
+
+    // Yanlış türle okuma değeri bozmaz
+    EXPECT_EQ(cache.get<int>("large", -1), -1);
+    EXPECT_EQ(cache.get<std::string>("large"), large);
+}
+
+} // namespace
+} // namespace data
+} // namespace alt_las
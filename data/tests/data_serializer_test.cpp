@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include "data/data_serializer.h"
+#include <map>
+#include <string>
+#include <vector>
+
+namespace alt_las {
+namespace data {
+namespace {
+
+/**
+ * @brief Farklı değer türleri içeren örnek belge üretir
+ *
+ * @return Belge
+ */
+nlohmann::json sampleDocument() {
+    nlohmann::json document;
+    document["id"] = 42;
+    document["negative"] = -7;
+    document["large"] = 1ull << 40;
+    document["ratio"] = 0.25;
+    document["name"] = "alt_las";
+    document["unicode"] = "çğışöü";
+    document["flag"] = true;
+    document["nothing"] = nullptr;
+    document["list"] = {1, 2, 3};
+    document["nested"] = {{"key", "value"}, {"empty", nlohmann::json::array()}};
+    return document;
+}
+
+TEST(DataSerializerTest, BinaryRoundTripKeepsDocument) {
+    DataSerializer& serializer = DataSerializer::getInstance();
+    nlohmann::json document = sampleDocument();
+
+    std::string binary = serializer.serialize(document, SerializationFormat::BINARY);
+    ASSERT_GT(binary.size(), sizeof(kBinaryMagic) + 1);
+    EXPECT_EQ(binary.compare(0, sizeof(kBinaryMagic), kBinaryMagic, sizeof(kBinaryMagic)), 0);
+    EXPECT_EQ(static_cast<uint8_t>(binary[sizeof(kBinaryMagic)]), kBinaryVersion);
+
+    EXPECT_EQ(serializer.deserialize<nlohmann::json>(binary, SerializationFormat::BINARY), document);
+}
+
+TEST(DataSerializerTest, BinaryRoundTripKeepsStandardContainers) {
+    DataSerializer& serializer = DataSerializer::getInstance();
+
+    std::map<std::string, int> counts = {{"a", 1}, {"b", -2}, {"c", 300000}};
+    std::string binary = serializer.serialize(counts, SerializationFormat::BINARY);
+    EXPECT_EQ((serializer.deserialize<std::map<std::string, int>>(binary, SerializationFormat::BINARY)), counts);
+
+    std::vector<std::string> names = {"", "x", std::string(1000, 'y')};
+    binary = serializer.serialize(names, SerializationFormat::BINARY);
+    EXPECT_EQ(serializer.deserialize<std::vector<std::string>>(binary, SerializationFormat::BINARY), names);
+}
+
+TEST(DataSerializerTest, BinaryIsSmallerThanJsonForIntegerData) {
+    DataSerializer& serializer = DataSerializer::getInstance();
+
+    std::vector<int> values;
+    for (int i = 0; i < 1000; i++) {
+        values.push_back(100000 + i * 37);
+    }
+
+    EXPECT_LT(serializer.serialize(values, SerializationFormat::BINARY).size(),
+              serializer.serialize(values, SerializationFormat::JSON).size());
+}
+
+TEST(DataSerializerTest, BinaryRejectsForeignOrCorruptData) {
+    DataSerializer& serializer = DataSerializer::getInstance();
+    std::string binary = serializer.serialize(sampleDocument(), SerializationFormat::BINARY);
+
+    // Boş veya yalnızca başlıktan oluşan veri
+    EXPECT_TRUE(serializer.deserialize<nlohmann::json>("", SerializationFormat::BINARY).is_null());
+    EXPECT_TRUE(serializer.deserialize<nlohmann::json>(binary.substr(0, sizeof(kBinaryMagic) + 1), SerializationFormat::BINARY).is_null());
+
+    // Yanlış imza
+    std::string badMagic = binary;
+    badMagic[0] = 'X';
+    EXPECT_TRUE(serializer.deserialize<nlohmann::json>(badMagic, SerializationFormat::BINARY).is_null());
+
+    // Yalnızca geçerli sürüm kabul edilir
+    std::string otherVersion = binary;
+    otherVersion[sizeof(kBinaryMagic)] = static_cast<char>(kBinaryVersion + 1);
+    EXPECT_TRUE(serializer.deserialize<nlohmann::json>(otherVersion, SerializationFormat::BINARY).is_null());
+    otherVersion[sizeof(kBinaryMagic)] = static_cast<char>(kBinaryVersion - 1);
+    EXPECT_TRUE(serializer.deserialize<nlohmann::json>(otherVersion, SerializationFormat::BINARY).is_null());
+
+    // Kesilmiş MessagePack verisi
+    EXPECT_TRUE(serializer.deserialize<nlohmann::json>(binary.substr(0, binary.size() - 3), SerializationFormat::BINARY).is_null());
+
+    // Eski JSON verisi ikili olarak okunmaz
+    std::string json = serializer.serialize(sampleDocument(), SerializationFormat::JSON);
+    EXPECT_TRUE(serializer.deserialize<nlohmann::json>(json, SerializationFormat::BINARY).is_null());
+}
+
+} // namespace
+} // namespace data
+} // namespace alt_las